@@ -0,0 +1,1219 @@
+/* MIT License
+ *
+ * Copyright (c) 2020 B1anky
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+/*
+ * Benchmark suite for isEqual, no dependencies beyond the standard library. Build it with `make benchmark` (or by hand with
+ * g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark) and run it as:
+ *
+ *     ./benchmark [--max-size N] [--max-node-size N] [--min-time seconds] [--json file] [--baseline file] [--threshold percent] [--scaling]
+ *
+ * Every dispatch branch of isEqual (fundamental, iterable, single pass, map, unordered, string, tuple/pair, operator==, nullptr and the always-false fallback),
+ * plus isEqualWith with mismatch reporting compiled out, switched on and instrumented, recording mismatches on the heap and in an arena, isEqualFingerprinted against candidates it can and can't rule out, isEqualBatch against isEqual in a loop, isEqualFastReject against isEqual, compareStats, MatrixViews laid out the same way and transposed, and halves, bfloat16s and quantized values against widening them first, gets timed for sizes 1, 10, 100 ... up to --max-size (--max-node-size for the node based containers, since a 1e8 entry std::map
+ * won't fit on most machines), across mixed type pairs. Each result reports ns/call, ns/element, bytes/s and how many times
+ * operator new got called per comparison.
+ *
+ * --json writes every result as one line of a JSON array (use - for stdout), and --baseline reads such a file back in and exits with
+ * a non-zero status if any case got slower than --threshold percent (10 by default), which is all a CI job needs to catch regressions.
+ * --scaling adds the isEqualParallel runs at 1, 2, 4 ... N threads.
+ */
+
+#include "isEqual.h"
+#include "isEqualFingerprint.h"
+#include "isEqualStats.h"
+#include "isEqualInstrumentation.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <list>
+#include <forward_list>
+#include <map>
+#include <unordered_map>
+#include <tuple>
+#include <array>
+#include <cstdint>
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <cstdlib>
+#include <cstddef>
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <thread>
+#include <memory_resource>
+
+//Same trick as the demo, every call to the global operator new gets counted so each case can report its allocations
+static std::atomic<std::size_t> allocationCount(0);
+
+//All of these are kept out of line, otherwise GCC pairs the inlined malloc()/free() calls with new/delete and warns about a mismatch that isn't there
+[[gnu::noinline]] void* operator new(std::size_t size){
+
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if(void* allocation = std::malloc(size ? size : 1)){
+
+        return allocation;
+
+    }
+
+    throw std::bad_alloc();
+
+}
+
+[[gnu::noinline]] void operator delete(void* allocation) noexcept{
+
+    std::free(allocation);
+
+}
+
+[[gnu::noinline]] void operator delete(void* allocation, std::size_t) noexcept{
+
+    std::free(allocation);
+
+}
+
+//std::pmr::new_delete_resource() (the default memory resource) allocates through the aligned overloads, so they get counted as well
+[[gnu::noinline]] void* operator new(std::size_t size, std::align_val_t alignment){
+
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    std::size_t alignmentBytes = static_cast<std::size_t>(alignment);
+
+    if(void* allocation = std::aligned_alloc(alignmentBytes, (std::max<std::size_t>(1, size) + alignmentBytes - 1) / alignmentBytes * alignmentBytes)){
+
+        return allocation;
+
+    }
+
+    throw std::bad_alloc();
+
+}
+
+[[gnu::noinline]] void operator delete(void* allocation, std::align_val_t) noexcept{
+
+    std::free(allocation);
+
+}
+
+[[gnu::noinline]] void operator delete(void* allocation, std::size_t, std::align_val_t) noexcept{
+
+    std::free(allocation);
+
+}
+
+//Stands in for any user type that only brings an operator== along
+class OnlyHasEqualityOperator{
+
+public:
+
+    OnlyHasEqualityOperator()
+        : id(0),
+          weight(0.0){
+
+        /* NOP */
+
+    }
+
+    OnlyHasEqualityOperator(int idIn, double weightIn)
+        :     id(idIn),
+          weight(weightIn){
+
+        /* NOP */
+
+    }
+
+    bool operator==(const OnlyHasEqualityOperator& other) const{
+
+        return id == other.id && weight == other.weight;
+
+    }
+
+public:
+
+    int    id;
+    double weight;
+
+};
+
+struct BenchmarkOptions{
+
+    std::size_t maxSize      = 10000000;
+    std::size_t maxNodeSize  = 1000000;
+    double      minSeconds   = 0.05;
+    double      threshold    = 10.0;
+    bool        scaling      = false;
+    std::string jsonPath;
+    std::string baselinePath;
+
+};
+
+struct BenchmarkResult{
+
+    std::string name;
+    std::string branch;
+    std::string types;
+    std::size_t elements           = 0;
+    double      nsPerCall          = 0.0;
+    double      nsPerElement       = 0.0;
+    double      bytesPerSecond     = 0.0;
+    double      allocationsPerCall = 0.0;
+
+};
+
+//Keeps the compiler from throwing the comparisons away
+static std::atomic<std::size_t> resultSink(0);
+
+//The constant time branches would otherwise fold into a single multiplication, this makes every single call count
+template <typename T>
+static inline void keepResult(const T& value){
+
+    #if defined(__GNUC__)
+
+    asm volatile("" : : "r,m"(value) : "memory");
+
+    #else
+
+    static volatile T sink;
+    sink = value;
+
+    #endif
+
+}
+
+/*
+ * Calls run() once to warm up (and to count its allocations), then doubles the iteration count until a batch takes at least
+ * minSeconds, and finally keeps the best of three such batches. bytesPerCall is whatever both sides occupy, so bytes/s is
+ * comparable across type pairs.
+ */
+template <typename Run>
+static BenchmarkResult measure(const std::string& branch, const std::string& types, std::size_t elements, std::size_t bytesPerCall,
+                               const BenchmarkOptions& options, const Run& run){
+
+    BenchmarkResult result;
+    result.branch   = branch;
+    result.types    = types;
+    result.elements = elements;
+    result.name     = branch + "/" + types + "/" + std::to_string(elements);
+
+    std::size_t allocationsBefore = allocationCount.load();
+    resultSink += run();
+    result.allocationsPerCall = static_cast<double>(allocationCount.load() - allocationsBefore);
+
+    std::size_t iterations  = 1;
+    double      bestSeconds = 0.0;
+
+    for(int batch = 0; batch < 3; ++batch){
+
+        double seconds = 0.0;
+
+        while(true){
+
+            auto start = std::chrono::steady_clock::now();
+
+            for(std::size_t iteration = 0; iteration < iterations; ++iteration){
+
+                resultSink += run();
+
+            }
+
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            //Only the first batch gets to pick the iteration count, the other two reuse it
+            if(batch > 0 || seconds >= options.minSeconds){
+
+                break;
+
+            }
+
+            iterations *= 2;
+
+        }
+
+        bestSeconds = (batch == 0) ? seconds : std::min(bestSeconds, seconds);
+
+    }
+
+    result.nsPerCall      = bestSeconds * 1E9 / iterations;
+    result.nsPerElement   = result.nsPerCall / std::max<std::size_t>(1, elements);
+    result.bytesPerSecond = bytesPerCall * iterations / bestSeconds;
+
+    std::cout << std::left  << std::setw(88) << result.name << std::right
+              << std::fixed << std::setprecision(3)
+              << std::setw(14) << result.nsPerCall    << " ns/call"
+              << std::setw(11) << result.nsPerElement << " ns/element"
+              << std::setw(10) << std::setprecision(2) << result.bytesPerSecond / 1E9 << " GB/s"
+              << std::setw(6)  << std::setprecision(0) << result.allocationsPerCall << " allocs" << std::endl;
+
+    return result;
+
+}
+
+//1, 10, 100 ... up to and including the limit, even when the limit isn't a power of ten
+static std::vector<std::size_t> sizesUpTo(std::size_t limit){
+
+    std::vector<std::size_t> sizes;
+
+    for(std::size_t size = 1; size <= limit; size *= 10){
+
+        sizes.push_back(size);
+
+        if(size > limit / 10){
+
+            break;
+
+        }
+
+    }
+
+    if(!sizes.empty() && sizes.back() != limit){
+
+        sizes.push_back(limit);
+
+    }
+
+    return sizes;
+
+}
+
+//A run of values that isn't just one constant repeated, small whole numbers so every type holds them exactly and mixed pairs stay equal
+template <typename T>
+static std::vector<T> makeValues(std::size_t count){
+
+    std::vector<T> values(count);
+
+    for(std::size_t index = 0; index < count; ++index){
+
+        values[index] = static_cast<T>(static_cast<int>(index % 1000) - 500);
+
+    }
+
+    return values;
+
+}
+
+//One fundamental isEqual call per element, so this measures the per-call cost of the scalar branch itself
+template <typename Fundamental1, typename Fundamental2>
+static void benchmarkFundamental(const std::string& types, const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::vector<Fundamental1> values1 = makeValues<Fundamental1>(size);
+        std::vector<Fundamental2> values2 = makeValues<Fundamental2>(size);
+
+        results.push_back(measure("fundamental", types, size, size * (sizeof(Fundamental1) + sizeof(Fundamental2)), options, [&](){
+
+            std::size_t equalCount = 0;
+
+            for(std::size_t index = 0; index < size; ++index){
+
+                bool isEqualRet = isEqual(values1[index], values2[index]);
+                keepResult(isEqualRet);
+                equalCount += isEqualRet;
+
+            }
+
+            return equalCount;
+
+        }));
+
+    }
+
+}
+
+template <typename Iterable1, typename Iterable2>
+static void benchmarkIterable(const std::string& branch, const std::string& types, std::size_t limit,
+                              const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    using Value1 = typename Iterable1::value_type;
+    using Value2 = typename Iterable2::value_type;
+
+    for(std::size_t size : sizesUpTo(limit)){
+
+        std::vector<Value1> values1 = makeValues<Value1>(size);
+        std::vector<Value2> values2 = makeValues<Value2>(size);
+        Iterable1           iterable1(values1.begin(), values1.end());
+        Iterable2           iterable2(values2.begin(), values2.end());
+
+        results.push_back(measure(branch, types, size, size * (sizeof(Value1) + sizeof(Value2)), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(iterable1, iterable2, 0.5));
+
+        }));
+
+    }
+
+}
+
+template <typename Map1, typename Map2>
+static void benchmarkMap(const std::string& branch, const std::string& types, const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    using Mapped1 = typename Map1::mapped_type;
+    using Mapped2 = typename Map2::mapped_type;
+
+    for(std::size_t size : sizesUpTo(options.maxNodeSize)){
+
+        Map1 map1;
+        Map2 map2;
+
+        for(std::size_t index = 0; index < size; ++index){
+
+            map1.emplace(static_cast<int>(index), static_cast<Mapped1>(index % 1000) / 8);
+            map2.emplace(static_cast<int>(index), static_cast<Mapped2>(index % 1000) / 8);
+
+        }
+
+        results.push_back(measure(branch, types, size, size * (2 * sizeof(int) + sizeof(Mapped1) + sizeof(Mapped2)), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(map1, map2));
+
+        }));
+
+    }
+
+}
+
+static void benchmarkTupleAndPair(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::vector<std::pair<int, double>>  pairs (size);
+        std::vector<std::tuple<int, float>>  tuples(size);
+
+        for(std::size_t index = 0; index < size; ++index){
+
+            pairs [index] = {static_cast<int>(index), static_cast<double>(index % 1000) / 8};
+            tuples[index] = {static_cast<int>(index), static_cast<float> (index % 1000) / 8};
+
+        }
+
+        results.push_back(measure("tuple_pair", "vector<pair<int,double>>-vector<tuple<int,float>>", size,
+                                  size * (sizeof(std::pair<int, double>) + sizeof(std::tuple<int, float>)), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(pairs, tuples));
+
+        }));
+
+    }
+
+}
+
+//The same equal inputs under each tolerance policy, absolute is the only one with vectorized kernels so it doubles as the baseline
+template <typename Value1, typename Value2, typename Tolerance>
+static void benchmarkPolicy(const std::string& types, const Tolerance& tolerance, const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::vector<Value1> values1 = makeValues<Value1>(size);
+        std::vector<Value2> values2 = makeValues<Value2>(size);
+
+        results.push_back(measure("policy", types, size, size * (sizeof(Value1) + sizeof(Value2)), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(values1, values2, tolerance));
+
+        }));
+
+    }
+
+}
+
+//Small fixed size arrays: integer ones go through memcmp as one flat run, mixed floating ones get unrolled per array
+template <typename Element1, typename Element2, std::size_t N>
+static void benchmarkSmallArrays(const std::string& types, const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::vector<std::array<Element1, N>> arrays1(size);
+        std::vector<std::array<Element2, N>> arrays2(size);
+
+        for(std::size_t index = 0; index < size; ++index){
+
+            for(std::size_t lane = 0; lane < N; ++lane){
+
+                arrays1[index][lane] = static_cast<Element1>(static_cast<int>((index + lane) % 1000) - 500);
+                arrays2[index][lane] = static_cast<Element2>(static_cast<int>((index + lane) % 1000) - 500);
+
+            }
+
+        }
+
+        results.push_back(measure("small_array", types, size, size * N * (sizeof(Element1) + sizeof(Element2)), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(arrays1, arrays2, 0.5));
+
+        }));
+
+    }
+
+}
+
+//A fingerprinted reference against a candidate that differs in its last element (ruled out by the digests alone) and one that's equal (full scan on top)
+static void benchmarkFingerprint(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::vector<double> values    = makeValues<double>(size);
+        std::vector<double> different = values;
+
+        different.back() += 1.0;
+
+        Fingerprinted<std::vector<double>> reference(values);
+        Fingerprinted<std::vector<double>> equalCandidate(values);
+        Fingerprinted<std::vector<double>> differentCandidate(different);
+
+        results.push_back(measure("fingerprint", "vector<double>-vector<double>/reject", size, size * 2 * sizeof(double), options, [&](){
+
+            return static_cast<std::size_t>(isEqualFingerprinted(reference, differentCandidate, 0.5));
+
+        }));
+
+        results.push_back(measure("fingerprint", "vector<double>-vector<double>/equal", size, size * 2 * sizeof(double), options, [&](){
+
+            return static_cast<std::size_t>(isEqualFingerprinted(reference, equalCandidate, 0.5));
+
+        }));
+
+    }
+
+}
+
+//256 candidates against one reference: isEqual in a loop, then isEqualBatch on one thread (tiling alone) and on every core
+static void benchmarkBatch(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    constexpr std::size_t candidateCount = 256;
+
+    ParallelOptions singleThread;
+    singleThread.threadCount = 1;
+
+    for(std::size_t size : sizesUpTo(options.maxSize / 64)){
+
+        std::vector<double>             reference = makeValues<double>(size);
+        std::vector<std::vector<float>> candidates(candidateCount, makeValues<float>(size));
+        std::size_t                     bytes     = candidateCount * size * (sizeof(double) + sizeof(float));
+
+        results.push_back(measure("batch", "vector<double>-256xvector<float>/loop", size * candidateCount, bytes, options, [&](){
+
+            std::size_t equalCount = 0;
+
+            for(const std::vector<float>& candidate : candidates){
+
+                equalCount += isEqual(reference, candidate, 0.5);
+
+            }
+
+            return equalCount;
+
+        }));
+
+        results.push_back(measure("batch", "vector<double>-256xvector<float>/tiled", size * candidateCount, bytes, options, [&](){
+
+            return isEqualBatch(reference, candidates, 0.5, singleThread).equalCount();
+
+        }));
+
+        results.push_back(measure("batch", "vector<double>-256xvector<float>/parallel", size * candidateCount, bytes, options, [&](){
+
+            return isEqualBatch(reference, candidates, 0.5).equalCount();
+
+        }));
+
+    }
+
+}
+
+//compareStats over equal inputs, which is the worst case for it too since it never stops early either way
+template <typename Value1, typename Value2>
+static void benchmarkStats(const std::string& types, const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::vector<Value1> values1 = makeValues<Value1>(size);
+        std::vector<Value2> values2 = makeValues<Value2>(size);
+
+        results.push_back(measure("stats", types, size, size * (sizeof(Value1) + sizeof(Value2)), options, [&](){
+
+            return compareStats(values1, values2, 0.5).overToleranceCount;
+
+        }));
+
+    }
+
+}
+
+//Square matrices as MatrixViews, laid out the same way (one strided run per row) and transposed against each other (64 x 64 tiles)
+static void benchmarkMatrix(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::size_t         side     = static_cast<std::size_t>(std::sqrt(static_cast<double>(size)));
+        std::size_t         elements = side * side;
+        std::vector<double> values1  = makeValues<double>(elements);
+        std::vector<float>  values2(elements);
+        std::vector<float>  values2Transposed(elements);
+
+        for(std::size_t row = 0; row < side; ++row){
+
+            for(std::size_t column = 0; column < side; ++column){
+
+                values2          [row * side + column] = static_cast<float>(values1[row * side + column]);
+                values2Transposed[column * side + row] = static_cast<float>(values1[row * side + column]);
+
+            }
+
+        }
+
+        MatrixView<const double> matrix1           = MatrixView<const double>::rowMajor(values1.data(), side, side);
+        MatrixView<const float>  matrix2           = MatrixView<const float>::rowMajor(values2.data(), side, side);
+        MatrixView<const float>  matrix2Transposed = MatrixView<const float>::columnMajor(values2Transposed.data(), side, side);
+
+        results.push_back(measure("matrix", "row_major<double>-row_major<float>", elements, elements * (sizeof(double) + sizeof(float)), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(matrix1, matrix2, 0.5));
+
+        }));
+
+        results.push_back(measure("matrix", "row_major<double>-column_major<float>", elements, elements * (sizeof(double) + sizeof(float)), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(matrix1, matrix2Transposed, 0.5));
+
+        }));
+
+    }
+
+}
+
+static void benchmarkEqualityOperator(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::vector<OnlyHasEqualityOperator> objects1(size);
+        std::vector<OnlyHasEqualityOperator> objects2(size);
+
+        for(std::size_t index = 0; index < size; ++index){
+
+            objects1[index] = objects2[index] = OnlyHasEqualityOperator(static_cast<int>(index), index * 0.5);
+
+        }
+
+        results.push_back(measure("operator_equal", "vector<OnlyHasEqualityOperator>-vector<OnlyHasEqualityOperator>", size,
+                                  2 * size * sizeof(OnlyHasEqualityOperator), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(objects1, objects2));
+
+        }));
+
+    }
+
+}
+
+/*
+ * The same equal inputs through the plain isEqual, through isEqualWith with reporting compiled out, with a MismatchReport attached
+ * and with an Instrumented reporter counting every branch. The first two are the same instantiation, so any gap between them is noise;
+ * the other two show what keeping reports or counters on costs. Then the first 64 mismatches of pairs that differ everywhere, recorded
+ * on the global heap and in an arena over a reused buffer.
+ */
+static void benchmarkMismatchReport(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    ComparisonInstrumentation instrumentation;
+
+    std::vector<std::byte>              arenaBuffer(1 << 16);
+    std::pmr::monotonic_buffer_resource arena(arenaBuffer.data(), arenaBuffer.size());
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::vector<std::pair<int, double>> pairs1(size);
+        std::vector<std::pair<int, float>>  pairs2(size);
+
+        for(std::size_t index = 0; index < size; ++index){
+
+            pairs1[index] = {static_cast<int>(index), static_cast<double>(index % 1000)};
+            pairs2[index] = {static_cast<int>(index), static_cast<float> (index % 1000)};
+
+        }
+
+        std::size_t bytesPerCall = size * (sizeof(std::pair<int, double>) + sizeof(std::pair<int, float>));
+        std::string types        = "vector<pair<int,double>>-vector<pair<int,float>>";
+
+        results.push_back(measure("report_plain", types, size, bytesPerCall, options, [&](){
+
+            return static_cast<std::size_t>(isEqual(pairs1, pairs2));
+
+        }));
+
+        results.push_back(measure("report_disabled", types, size, bytesPerCall, options, [&](){
+
+            NoMismatchReport noReport;
+            return static_cast<std::size_t>(isEqualWith(pairs1, pairs2, TOLERANCE, noReport));
+
+        }));
+
+        results.push_back(measure("report_enabled", types, size, bytesPerCall, options, [&](){
+
+            MismatchReport report;
+            return static_cast<std::size_t>(isEqualWith(pairs1, pairs2, TOLERANCE, report));
+
+        }));
+
+        results.push_back(measure("report_instrumented", types, size, bytesPerCall, options, [&](){
+
+            Instrumented<> counted(instrumentation);
+            return static_cast<std::size_t>(isEqualWith(pairs1, pairs2, TOLERANCE, counted));
+
+        }));
+
+        std::vector<std::pair<int, float>> allDifferent = pairs2;
+
+        for(std::pair<int, float>& pair : allDifferent){
+
+            pair.second += 1.0f;
+
+        }
+
+        results.push_back(measure("report_mismatches", types + "/heap", size, bytesPerCall, options, [&](){
+
+            MismatchReport report(64);
+            isEqualWith(pairs1, allDifferent, TOLERANCE, report);
+            return report.count();
+
+        }));
+
+        results.push_back(measure("report_mismatches", types + "/arena", size, bytesPerCall, options, [&](){
+
+            std::size_t recorded = 0;
+
+            {
+
+                MismatchReport report(64, &arena);
+                isEqualWith(pairs1, allDifferent, TOLERANCE, report);
+                recorded = report.count();
+
+            }
+
+            arena.release();
+            return recorded;
+
+        }));
+
+    }
+
+}
+
+/*
+ * Pairs whose last tenth differs everywhere, which the plain isEqual only finds after walking the first nine tenths and
+ * isEqualFastReject finds with its last block probe, plus equal pairs to show what the probes cost when they find nothing.
+ */
+static void benchmarkFastReject(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::vector<double> values1   = makeValues<double>(size);
+        std::vector<float>  values2   = makeValues<float>(size);
+        std::vector<float>  tailDiffs = values2;
+
+        for(std::size_t index = size - size / 10; index < size; ++index){
+
+            tailDiffs[index] += 1.0f;
+
+        }
+
+        std::size_t bytesPerCall = size * (sizeof(double) + sizeof(float));
+
+        results.push_back(measure("fast_reject", "vector<double>-vector<float>/tail_differs/plain", size, bytesPerCall, options, [&](){
+
+            return static_cast<std::size_t>(isEqual(values1, tailDiffs, 0.5));
+
+        }));
+
+        results.push_back(measure("fast_reject", "vector<double>-vector<float>/tail_differs/probed", size, bytesPerCall, options, [&](){
+
+            return static_cast<std::size_t>(isEqualFastReject(values1, tailDiffs, 0.5));
+
+        }));
+
+        results.push_back(measure("fast_reject", "vector<double>-vector<float>/equal/probed", size, bytesPerCall, options, [&](){
+
+            return static_cast<std::size_t>(isEqualFastReject(values1, values2, 0.5));
+
+        }));
+
+    }
+
+    for(std::size_t size : sizesUpTo(options.maxNodeSize)){
+
+        std::map<int, std::vector<double>> map1;
+        std::map<int, std::vector<double>> map2;
+
+        for(std::size_t index = 0; index < size; ++index){
+
+            map1[static_cast<int>(index)] = std::vector<double>(16, static_cast<double>(index % 1000));
+            map2[static_cast<int>(index)] = std::vector<double>(16, static_cast<double>(index % 1000) + (index >= size - size / 10 ? 1.0 : 0.0));
+
+        }
+
+        std::size_t bytesPerCall = size * 2 * (sizeof(int) + 16 * sizeof(double));
+
+        results.push_back(measure("fast_reject", "map<int,vector<double>>/tail_differs/plain", size, bytesPerCall, options, [&](){
+
+            return static_cast<std::size_t>(isEqual(map1, map2, 0.5));
+
+        }));
+
+        results.push_back(measure("fast_reject", "map<int,vector<double>>/tail_differs/probed", size, bytesPerCall, options, [&](){
+
+            return static_cast<std::size_t>(isEqualFastReject(map1, map2, 0.5));
+
+        }));
+
+    }
+
+}
+
+/*
+ * Halves, bfloat16s and int8 quantized values against float and double references, widened in registers, next to the way it had to be
+ * done before: widening the whole run into a std::vector<float> first and comparing that. Bytes count what's actually stored on each side.
+ */
+static void benchmarkReducedPrecision(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::vector<float>       floats    = makeValues<float>(size);
+        std::vector<double>      doubles   = makeValues<double>(size);
+        std::vector<Float16>     halves(size);
+        std::vector<BFloat16>    bfloat16s(size);
+        std::vector<std::int8_t> quantized(size);
+        std::vector<float>       dequantized(size);
+
+        for(std::size_t index = 0; index < size; ++index){
+
+            halves[index]      = Float16(floats[index]);
+            bfloat16s[index]   = BFloat16(floats[index]);
+            quantized[index]   = static_cast<std::int8_t>(static_cast<int>(index % 200) - 100);
+            dequantized[index] = static_cast<float>(quantized[index]) * 0.5f;
+
+        }
+
+        QuantizedView<std::int8_t> quantizedView(quantized.data(), size, 0.5f);
+
+        results.push_back(measure("reduced", "vector<Float16>-vector<float>", size, size * (sizeof(Float16) + sizeof(float)), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(halves, floats));
+
+        }));
+
+        results.push_back(measure("reduced", "vector<Float16>-vector<float>/widened_copy", size, size * (sizeof(Float16) + sizeof(float)), options, [&](){
+
+            std::vector<float> widened(halves.size());
+            std::transform(halves.begin(), halves.end(), widened.begin(), [](Float16 half){ return half.toFloat(); });
+
+            return static_cast<std::size_t>(isEqual(widened, floats));
+
+        }));
+
+        results.push_back(measure("reduced", "vector<Float16>-vector<double>", size, size * (sizeof(Float16) + sizeof(double)), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(halves, doubles));
+
+        }));
+
+        //bfloat16 only holds whole numbers exactly up to 256, past that they're up to 1 off
+        results.push_back(measure("reduced", "vector<BFloat16>-vector<float>", size, size * (sizeof(BFloat16) + sizeof(float)), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(bfloat16s, floats, 1.0));
+
+        }));
+
+        results.push_back(measure("reduced", "QuantizedView<int8_t>-vector<float>", size, size * (sizeof(std::int8_t) + sizeof(float)), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(quantizedView, dequantized));
+
+        }));
+
+        results.push_back(measure("reduced", "QuantizedView<int8_t>-vector<float>/widened_copy", size, size * (sizeof(std::int8_t) + sizeof(float)), options, [&](){
+
+            std::vector<float> widened(quantizedView.begin(), quantizedView.end());
+
+            return static_cast<std::size_t>(isEqual(widened, dequantized));
+
+        }));
+
+    }
+
+}
+
+//Strings through memcmp (and the SIMD ASCII fold), plus config style maps whose keys are where most of the time goes
+static void benchmarkStrings(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        std::string string1(size, 'x');
+
+        for(std::size_t index = 0; index < size; ++index){
+
+            string1[index] = static_cast<char>('a' + index % 26);
+
+        }
+
+        std::string      string2 = string1;
+        std::string      upper   = string1;
+        std::string_view view2   = string2;
+
+        std::transform(upper.begin(), upper.end(), upper.begin(), [](char character){ return static_cast<char>(character - 'a' + 'A'); });
+
+        results.push_back(measure("string", "string-string", size, 2 * size, options, [&](){
+
+            return static_cast<std::size_t>(isEqual(string1, string2));
+
+        }));
+
+        results.push_back(measure("string", "string-string_view", size, 2 * size, options, [&](){
+
+            return static_cast<std::size_t>(isEqual(string1, view2));
+
+        }));
+
+        results.push_back(measure("string", "string-string/ascii_case_insensitive", size, 2 * size, options, [&](){
+
+            return static_cast<std::size_t>(isEqual(asciiCaseInsensitive(string1), upper));
+
+        }));
+
+    }
+
+    for(std::size_t size : sizesUpTo(options.maxNodeSize)){
+
+        std::map<std::string, double> config1;
+        std::map<std::string, float>  config2;
+
+        for(std::size_t index = 0; index < size; ++index){
+
+            std::string key = "service.section.setting." + std::to_string(index);
+
+            config1[key] = static_cast<double>(index % 1000);
+            config2[key] = static_cast<float> (index % 1000);
+
+        }
+
+        results.push_back(measure("string", "map<string,double>-map<string,float>", size, size * 2 * (sizeof(std::string) + 24), options, [&](){
+
+            return static_cast<std::size_t>(isEqual(config1, config2));
+
+        }));
+
+    }
+
+}
+
+//Both of these are constant time per call, so the size is just how many calls get made in a row
+static void benchmarkNullptrAndFallback(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    std::vector<float> floatVector = makeValues<float>(1000);
+
+    for(std::size_t size : sizesUpTo(options.maxSize)){
+
+        results.push_back(measure("nullptr", "nullptr_t-nullptr_t", size, 0, options, [&](){
+
+            std::size_t equalCount = 0;
+
+            for(std::size_t index = 0; index < size; ++index){
+
+                bool isEqualRet = isEqual(nullptr, nullptr);
+                keepResult(isEqualRet);
+                equalCount += isEqualRet;
+
+            }
+
+            return equalCount;
+
+        }));
+
+        results.push_back(measure("fallback", "vector<float>-double", size, 0, options, [&](){
+
+            std::size_t equalCount = 0;
+
+            for(std::size_t index = 0; index < size; ++index){
+
+                bool isEqualRet = isEqual(floatVector, 2.9);
+                keepResult(isEqualRet);
+                equalCount += isEqualRet;
+
+            }
+
+            return equalCount;
+
+        }));
+
+    }
+
+}
+
+static void benchmarkParallelScaling(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results){
+
+    std::size_t         maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<double> doubles    = makeValues<double>(options.maxSize);
+    std::vector<float>  floats     = makeValues<float> (options.maxSize);
+
+    std::vector<std::array<float, 3>>  floatPoints (options.maxSize / 3);
+    std::vector<std::array<double, 3>> doublePoints(options.maxSize / 3);
+
+    for(std::size_t index = 0; index < floatPoints.size(); ++index){
+
+        floatPoints[index]  = {floats[3 * index], floats[3 * index + 1], floats[3 * index + 2]};
+        doublePoints[index] = {doubles[3 * index], doubles[3 * index + 1], doubles[3 * index + 2]};
+
+    }
+
+    for(std::size_t threadCount = 1; ; threadCount = std::min(threadCount * 2, maxThreads)){
+
+        ParallelOptions parallelOptions;
+        parallelOptions.threadCount     = threadCount;
+        parallelOptions.minimumElements = 0;
+
+        results.push_back(measure("parallel_" + std::to_string(threadCount) + "_threads", "vector<float>-vector<double>", options.maxSize,
+                                  options.maxSize * (sizeof(float) + sizeof(double)), options, [&](){
+
+            return static_cast<std::size_t>(isEqualParallel(floats, doubles, TOLERANCE, parallelOptions));
+
+        }));
+
+        results.push_back(measure("parallel_" + std::to_string(threadCount) + "_threads", "vector<array<float,3>>-vector<array<double,3>>", floatPoints.size(),
+                                  floatPoints.size() * (sizeof(std::array<float, 3>) + sizeof(std::array<double, 3>)), options, [&](){
+
+            return static_cast<std::size_t>(isEqualParallel(floatPoints, doublePoints, TOLERANCE, parallelOptions));
+
+        }));
+
+        if(threadCount == maxThreads){
+
+            break;
+
+        }
+
+    }
+
+}
+
+static const char* simdLevelName(isEqualDetail::SimdLevel simdLevel){
+
+    switch(simdLevel){
+        case isEqualDetail::SimdLevel::AVX512: return "AVX512";
+        case isEqualDetail::SimdLevel::AVX2:   return "AVX2";
+        case isEqualDetail::SimdLevel::SSE2:   return "SSE2";
+        default:                               return "Scalar";
+    }
+
+}
+
+//One result per line, which keeps the file diffable with plain text tools and lets readBaseline get away without a real JSON parser
+static void writeJson(std::ostream& output, const std::vector<BenchmarkResult>& results){
+
+    output << "{" << std::endl
+           << "  \"simd_level\": \"" << simdLevelName(isEqualDetail::detectSimdLevel()) << "\"," << std::endl
+           << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << "," << std::endl
+           << "  \"results\": [" << std::endl;
+
+    for(std::size_t index = 0; index < results.size(); ++index){
+
+        const BenchmarkResult& result = results[index];
+
+        output << std::setprecision(6) << std::defaultfloat
+               << "    {\"name\": \"" << result.name << "\", \"branch\": \"" << result.branch << "\", \"types\": \"" << result.types << "\""
+               << ", \"elements\": " << result.elements
+               << ", \"ns_per_call\": " << result.nsPerCall
+               << ", \"ns_per_element\": " << result.nsPerElement
+               << ", \"bytes_per_second\": " << result.bytesPerSecond
+               << ", \"allocations_per_call\": " << result.allocationsPerCall << "}"
+               << (index + 1 < results.size() ? "," : "") << std::endl;
+
+    }
+
+    output << "  ]" << std::endl
+           << "}" << std::endl;
+
+}
+
+//Pulls the name and ns_per_call back out of every result line a previous writeJson produced
+static std::map<std::string, double> readBaseline(const std::string& path){
+
+    std::map<std::string, double> baseline;
+    std::ifstream                 input(path);
+    std::string                   line;
+
+    while(std::getline(input, line)){
+
+        std::size_t nameStart = line.find("\"name\": \"");
+        std::size_t timeStart = line.find("\"ns_per_call\": ");
+
+        if(nameStart == std::string::npos || timeStart == std::string::npos){
+
+            continue;
+
+        }
+
+        nameStart += 9;
+        baseline[line.substr(nameStart, line.find('"', nameStart) - nameStart)] = std::strtod(line.c_str() + timeStart + 15, nullptr);
+
+    }
+
+    return baseline;
+
+}
+
+int main(int argc, char** argv){
+
+    BenchmarkOptions options;
+
+    for(int arg = 1; arg < argc; ++arg){
+
+        std::string flag  = argv[arg];
+        const char* value = (arg + 1 < argc) ? argv[arg + 1] : "";
+
+        if     (flag == "--max-size")      { options.maxSize      = std::strtoull(value, nullptr, 10); ++arg; }
+        else if(flag == "--max-node-size") { options.maxNodeSize  = std::strtoull(value, nullptr, 10); ++arg; }
+        else if(flag == "--min-time")      { options.minSeconds   = std::strtod(value, nullptr);       ++arg; }
+        else if(flag == "--threshold")     { options.threshold    = std::strtod(value, nullptr);       ++arg; }
+        else if(flag == "--json")          { options.jsonPath     = value;                             ++arg; }
+        else if(flag == "--baseline")      { options.baselinePath = value;                             ++arg; }
+        else if(flag == "--scaling")       { options.scaling      = true;                                     }
+        else{
+
+            std::cerr << "unknown argument: " << flag << std::endl;
+            return 2;
+
+        }
+
+    }
+
+    options.maxSize     = std::max<std::size_t>(1, options.maxSize);
+    options.maxNodeSize = std::max<std::size_t>(1, std::min(options.maxNodeSize, options.maxSize));
+
+    std::cout << "SIMD level: " << simdLevelName(isEqualDetail::detectSimdLevel()) << std::endl << std::endl;
+
+    std::vector<BenchmarkResult> results;
+
+    benchmarkFundamental<double, double>("double-double", options, results);
+    benchmarkFundamental<float,  double>("float-double",  options, results);
+    benchmarkFundamental<int,    float> ("int-float",     options, results);
+
+    benchmarkIterable<std::vector<double>, std::vector<double>>("iterable", "vector<double>-vector<double>", options.maxSize,     options, results);
+    benchmarkIterable<std::vector<float>,  std::vector<double>>("iterable", "vector<float>-vector<double>",  options.maxSize,     options, results);
+    benchmarkIterable<std::vector<int>,    std::vector<float>> ("iterable", "vector<int>-vector<float>",     options.maxSize,     options, results);
+    benchmarkIterable<std::vector<int>,    std::vector<int>>   ("iterable", "vector<int>-vector<int>",       options.maxSize,     options, results);
+    benchmarkIterable<std::list<double>,   std::vector<float>> ("iterable", "list<double>-vector<float>",    options.maxNodeSize, options, results);
+    benchmarkIterable<std::forward_list<double>, std::vector<float>>("single_pass", "forward_list<double>-vector<float>", options.maxNodeSize, options, results);
+
+    benchmarkMap<std::map<int, double>,           std::map<int, float>>          ("map",       "map<int,double>-map<int,float>",                     options, results);
+    benchmarkMap<std::unordered_map<int, double>, std::unordered_map<int, float>>("unordered", "unordered_map<int,double>-unordered_map<int,float>", options, results);
+
+    benchmarkPolicy<double,       double>      ("absolute/vector<double>-vector<double>",   AbsoluteTolerance(1E-9),         options, results);
+    benchmarkPolicy<double,       double>      ("exact/vector<double>-vector<double>",      ExactTolerance(),                options, results);
+    benchmarkPolicy<double,       double>      ("relative/vector<double>-vector<double>",   RelativeTolerance(1E-9),         options, results);
+    benchmarkPolicy<double,       double>      ("ulp/vector<double>-vector<double>",        UlpTolerance(4),                 options, results);
+    benchmarkPolicy<double,       double>      ("absrel/vector<double>-vector<double>",     AbsRelTolerance(1E-12, 1E-9),    options, results);
+    benchmarkPolicy<std::int64_t, std::int64_t>("absolute/vector<int64_t>-vector<int64_t>", AbsoluteTolerance(2.0),          options, results);
+    benchmarkPolicy<std::int64_t, double>      ("absolute/vector<int64_t>-vector<double>",  AbsoluteTolerance(0.5),          options, results);
+
+    benchmarkSmallArrays<int,   int,    4>("vector<array<int,4>>-vector<array<int,4>>",       options, results);
+    benchmarkSmallArrays<float, double, 3>("vector<array<float,3>>-vector<array<double,3>>", options, results);
+
+    benchmarkMatrix(options, results);
+
+    benchmarkTupleAndPair      (options, results);
+    benchmarkEqualityOperator  (options, results);
+    benchmarkMismatchReport    (options, results);
+    benchmarkFingerprint       (options, results);
+    benchmarkBatch             (options, results);
+
+    benchmarkStats<double, double>("vector<double>-vector<double>", options, results);
+    benchmarkStats<float,  double>("vector<float>-vector<double>",  options, results);
+    benchmarkStats<int,    float> ("vector<int>-vector<float>",     options, results);
+
+    benchmarkFastReject(options, results);
+    benchmarkStrings(options, results);
+    benchmarkReducedPrecision(options, results);
+
+    benchmarkNullptrAndFallback(options, results);
+
+    if(options.scaling){
+
+        benchmarkParallelScaling(options, results);
+
+    }
+
+    if(!options.jsonPath.empty()){
+
+        if(options.jsonPath == "-"){
+
+            writeJson(std::cout, results);
+
+        }
+        else{
+
+            std::ofstream jsonFile(options.jsonPath);
+            writeJson(jsonFile, results);
+
+        }
+
+    }
+
+    int exitCode = 0;
+
+    if(!options.baselinePath.empty()){
+
+        std::map<std::string, double> baseline = readBaseline(options.baselinePath);
+
+        std::cout << std::endl << "Compared against " << options.baselinePath << " (" << baseline.size() << " cases):" << std::endl;
+
+        for(const BenchmarkResult& result : results){
+
+            auto baselineIter = baseline.find(result.name);
+
+            if(baselineIter == baseline.end() || baselineIter->second <= 0.0){
+
+                continue;
+
+            }
+
+            double change = (result.nsPerCall / baselineIter->second - 1.0) * 100.0;
+
+            if(change > options.threshold){
+
+                std::cout << "    REGRESSION " << result.name << ": " << std::fixed << std::setprecision(1) << change << "% slower" << std::endl;
+                exitCode = 1;
+
+            }
+
+        }
+
+        if(exitCode == 0){
+
+            std::cout << "    no case got more than " << options.threshold << "% slower" << std::endl;
+
+        }
+
+    }
+
+    return exitCode;
+
+}
@@ -0,0 +1,158 @@
+/* MIT License
+ *
+ * Copyright (c) 2020 B1anky
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+/*
+ * Command line front end for isEqualFiles. Build it with `make compare-files` and run it as:
+ *
+ *     ./compare-files [--type T | --type1 T --type2 T] [--tolerance X | --relative X | --ulp N | --exact]
+ *                     [--offset N | --offset1 N --offset2 N] [--count N] [--window-mb N] file1 file2
+ *
+ * T is one of f32, f64, i8, i16, i32, i64, u8, u16, u32 or u64 (f64 by default), the tolerance defaults to TOLERANCE,
+ * offsets are in bytes (for skipping headers) and --count limits how many elements get compared.
+ * Exits with 0 when the files are equal, 1 when they aren't and 2 when they couldn't be compared at all.
+ */
+
+#include "isEqualFile.h"
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+
+//Prints whatever the comparison found, and turns it into the exit status
+static int report(const FileCompareResult& result){
+
+    if(!result.error.empty()){
+
+        std::cerr << result.error << std::endl;
+        return 2;
+
+    }
+
+    if(result.equal){
+
+        std::cout << "equal (" << result.elementsCompared << " elements)" << std::endl;
+        return 0;
+
+    }
+
+    if(result.hasMismatch){
+
+        std::cout << "first mismatch at element " << result.mismatchIndex
+                  << " (byte " << result.mismatchOffset1 << " in file1, byte " << result.mismatchOffset2 << " in file2): "
+                  << result.value1 << " vs " << result.value2 << std::endl;
+
+    }
+    else{
+
+        std::cout << "element counts differ: " << result.elementCount1 << " vs " << result.elementCount2 << std::endl;
+
+    }
+
+    return 1;
+
+}
+
+int main(int argc, char** argv){
+
+    FileElementType    elementType1   = FileElementType::F64;
+    FileElementType    elementType2   = FileElementType::F64;
+    FileCompareOptions options;
+    std::string        policyName     = "absolute";
+    double             toleranceValue = TOLERANCE;
+    std::string        paths[2];
+    int                pathCount      = 0;
+
+    for(int arg = 1; arg < argc; ++arg){
+
+        std::string flag  = argv[arg];
+        const char* value = (arg + 1 < argc) ? argv[arg + 1] : "";
+        bool        typeOk = true;
+
+        if     (flag == "--type")      { typeOk = parseFileElementType(value, elementType1) && parseFileElementType(value, elementType2); ++arg; }
+        else if(flag == "--type1")     { typeOk = parseFileElementType(value, elementType1);                                              ++arg; }
+        else if(flag == "--type2")     { typeOk = parseFileElementType(value, elementType2);                                              ++arg; }
+        else if(flag == "--tolerance") { policyName = "absolute"; toleranceValue = std::strtod(value, nullptr);                          ++arg; }
+        else if(flag == "--relative")  { policyName = "relative"; toleranceValue = std::strtod(value, nullptr);                          ++arg; }
+        else if(flag == "--ulp")       { policyName = "ulp";      toleranceValue = std::strtod(value, nullptr);                          ++arg; }
+        else if(flag == "--exact")     { policyName = "exact";                                                                                  }
+        else if(flag == "--offset")    { options.offset1 = options.offset2 = std::strtoull(value, nullptr, 10);                           ++arg; }
+        else if(flag == "--offset1")   { options.offset1     = std::strtoull(value, nullptr, 10);                                         ++arg; }
+        else if(flag == "--offset2")   { options.offset2     = std::strtoull(value, nullptr, 10);                                         ++arg; }
+        else if(flag == "--count")     { options.maxElements = std::strtoull(value, nullptr, 10);                                         ++arg; }
+        else if(flag == "--window-mb") { options.windowBytes = std::strtoull(value, nullptr, 10) << 20;                                   ++arg; }
+        else if(flag.rfind("--", 0) != 0 && pathCount < 2){
+
+            paths[pathCount++] = flag;
+
+        }
+        else{
+
+            std::cerr << "unknown argument: " << flag << std::endl;
+            return 2;
+
+        }
+
+        if(!typeOk){
+
+            std::cerr << "unknown element type: " << value << " (expected f32, f64, i8, i16, i32, i64, u8, u16, u32 or u64)" << std::endl;
+            return 2;
+
+        }
+
+    }
+
+    //A 0 (or anything that didn't parse as a number) would leave nothing to compare a window at a time
+    if(options.windowBytes == 0){
+
+        std::cerr << "--window-mb has to be at least 1" << std::endl;
+        return 2;
+
+    }
+
+    if(pathCount != 2){
+
+        std::cerr << "usage: compare-files [--type T | --type1 T --type2 T] [--tolerance X | --relative X | --ulp N | --exact]" << std::endl
+                  << "                     [--offset N | --offset1 N --offset2 N] [--count N] [--window-mb N] file1 file2" << std::endl;
+        return 2;
+
+    }
+
+    if(policyName == "relative"){
+
+        return report(isEqualFiles(paths[0], elementType1, paths[1], elementType2, RelativeTolerance(toleranceValue), options));
+
+    }
+    else if(policyName == "ulp"){
+
+        return report(isEqualFiles(paths[0], elementType1, paths[1], elementType2, UlpTolerance(static_cast<std::uint64_t>(toleranceValue)), options));
+
+    }
+    else if(policyName == "exact"){
+
+        return report(isEqualFiles(paths[0], elementType1, paths[1], elementType2, ExactTolerance(), options));
+
+    }
+
+    return report(isEqualFiles(paths[0], elementType1, paths[1], elementType2, AbsoluteTolerance(toleranceValue), options));
+
+}
@@ -0,0 +1,5035 @@
+/* MIT License
+ *
+ * Copyright (c) 2020 B1anky
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#ifndef ISEQUAL_H
+#define ISEQUAL_H
+
+#include <ostream>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <type_traits>
+#include <iterator>
+#include <vector>
+#include <list>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <memory_resource>
+#include <array>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <exception>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#define TOLERANCE 1E-5
+
+//Everything in here is an implementation detail, the using-declarations let the unqualified begin/end/size calls below
+//find the std:: versions for C arrays while still letting ADL find any user-defined free functions
+namespace isEqualDetail{
+
+    using std::begin;
+    using std::end;
+    using std::size;
+
+    //This allows us to test for what we can freely "assume" to be iterable, you can make that more or less strict depending on use cases
+    template <typename T>
+    auto is_iterable_impl(int)
+    -> decltype (
+        begin(std::declval<T&>()) != end(std::declval<T&>()),   // begin/end and operator !=
+        void(),                                                 // Handle evil operator
+        size(std::declval<T&>()),                               // Handle safely getting the size, since most iterables have this function
+        ++std::declval<decltype(begin(std::declval<T&>()))&>(), // operator ++
+        --std::declval<decltype(begin(std::declval<T&>()))&>(), // operator --
+        void(*begin(std::declval<T&>())),                       // operator*
+        std::true_type{});
+
+    //This will call the above template, if possible, but if not, will be of std::false_type at compilation time
+    template <typename T>
+    std::false_type is_iterable_impl(...);
+
+    //The bare minimum to walk something once from front to back: no size, no operator --, and no promise a second pass sees the same
+    //elements (std::forward_list, istream_iterator ranges, anything reading off a socket or a decompressor...)
+    template <typename T>
+    auto is_single_pass_iterable_impl(int)
+    -> decltype (
+        begin(std::declval<const T&>()) != end(std::declval<const T&>()),   // begin/end and operator !=
+        void(),                                                             // Handle evil operator
+        ++std::declval<decltype(begin(std::declval<const T&>()))&>(),       // operator ++
+        void(*begin(std::declval<const T&>())),                             // operator*
+        std::true_type{});
+
+    template <typename T>
+    std::false_type is_single_pass_iterable_impl(...);
+
+    //These mirror the checks above so that the loops in isEqual work on C arrays and views just as well as on containers
+    template <typename T>
+    constexpr auto adlBegin(const T& iterable) -> decltype(begin(iterable)){
+
+        return begin(iterable);
+
+    }
+
+    template <typename T>
+    constexpr auto adlEnd(const T& iterable) -> decltype(end(iterable)){
+
+        return end(iterable);
+
+    }
+
+    template <typename T>
+    constexpr auto adlSize(const T& iterable) -> decltype(size(iterable)){
+
+        return size(iterable);
+
+    }
+
+} //namespace isEqualDetail
+
+//Tucked away in a namespace of its own so the catch-all operator== below only ever gets seen by EqualExists. Left out in the open it
+//would outbid the real operator== of any iterator compared with != (C++20 rewrites != into ==), and hijack the comparison.
+namespace isEqualDetail{ namespace equalityCheck{
+
+    //naming this No because if No operator== exists, its value will be 0 (Get it? It's like english but worse)
+    struct No {};
+    template<typename T, typename Arg> No operator== (const T&, const Arg&);
+
+    template<typename T, typename Arg = T>
+    struct EqualExists
+    {
+      enum { value = !std::is_same<decltype(std::declval<T>() == std::declval<Arg>()), No>::value };
+    };
+
+} } //namespace isEqualDetail::equalityCheck
+
+using isEqualDetail::equalityCheck::EqualExists;
+
+//these two are for maps specifically, pretty simple, but we're only using the structs as a wrapper for the constexpr
+//Any comparator and allocator counts, so std::map<std::string, int, std::greater<>> or a std::pmr::map is still a map
+template <class T>
+struct is_map {
+    static constexpr bool value = false;
+};
+
+template<class Key, class Value, class Compare, class Allocator>
+struct is_map<std::map<Key, Value, Compare, Allocator>> {
+    static constexpr bool value = true;
+};
+
+template<class Key, class Value, class Compare, class Allocator>
+struct is_map<std::multimap<Key, Value, Compare, Allocator>> {
+    static constexpr bool value = true;
+};
+
+//Sets are already sorted by their comparator, so like maps they can be compared position by position
+template <class T>
+struct is_set {
+    static constexpr bool value = false;
+};
+
+template<class Key, class Compare, class Allocator>
+struct is_set<std::set<Key, Compare, Allocator>> {
+    static constexpr bool value = true;
+};
+
+template<class Key, class Compare, class Allocator>
+struct is_set<std::multiset<Key, Compare, Allocator>> {
+    static constexpr bool value = true;
+};
+
+//The hash based ones get their own traits, since walking two of them side by side means nothing (equal ones can iterate in different orders)
+template <class T>
+struct is_unordered_map {
+    static constexpr bool value = false;
+};
+
+template<class Key, class Value, class Hash, class KeyEqual, class Allocator>
+struct is_unordered_map<std::unordered_map<Key, Value, Hash, KeyEqual, Allocator>> {
+    static constexpr bool value = true;
+};
+
+template<class Key, class Value, class Hash, class KeyEqual, class Allocator>
+struct is_unordered_map<std::unordered_multimap<Key, Value, Hash, KeyEqual, Allocator>> {
+    static constexpr bool value = true;
+};
+
+template <class T>
+struct is_unordered_set {
+    static constexpr bool value = false;
+};
+
+template<class Key, class Hash, class KeyEqual, class Allocator>
+struct is_unordered_set<std::unordered_set<Key, Hash, KeyEqual, Allocator>> {
+    static constexpr bool value = true;
+};
+
+template<class Key, class Hash, class KeyEqual, class Allocator>
+struct is_unordered_set<std::unordered_multiset<Key, Hash, KeyEqual, Allocator>> {
+    static constexpr bool value = true;
+};
+
+namespace isEqualDetail{
+
+    template <class T>
+    struct is_hashed : std::bool_constant<is_unordered_map<T>::value || is_unordered_set<T>::value> {};
+
+    //Neither side holding the same key twice lets a lookup stop at the first match, the multimaps and multisets get every entry under a key
+    template <class T>
+    struct is_unique_key : std::false_type {};
+
+    template<class Key, class Value, class Hash, class KeyEqual, class Allocator>
+    struct is_unique_key<std::unordered_map<Key, Value, Hash, KeyEqual, Allocator>> : std::true_type {};
+
+    template<class Key, class Hash, class KeyEqual, class Allocator>
+    struct is_unique_key<std::unordered_set<Key, Hash, KeyEqual, Allocator>> : std::true_type {};
+
+    template<class Key, class Value, class Compare, class Allocator>
+    struct is_unique_key<std::map<Key, Value, Compare, Allocator>> : std::true_type {};
+
+    template<class Key, class Compare, class Allocator>
+    struct is_unique_key<std::set<Key, Compare, Allocator>> : std::true_type {};
+
+    //Which side the keys get looked up in, only ever instantiated (through std::conjunction) once both sides are known to have a key_type.
+    //It has to be one whose key_type the other side's keys convert to (a const char* finds a std::string, never the other way around),
+    //and it's the hashed one whenever that's an option.
+    template <class Comparable1, class Comparable2>
+    struct lookup_direction{
+
+        static constexpr bool into1 = std::is_convertible_v<typename Comparable2::key_type, typename Comparable1::key_type>;
+        static constexpr bool into2 = std::is_convertible_v<typename Comparable1::key_type, typename Comparable2::key_type>;
+
+        static constexpr bool intoComparable2 = into2 && (is_hashed<Comparable2>::value || !(into1 && is_hashed<Comparable1>::value));
+        static constexpr bool value           = into1 || into2;
+
+    };
+
+    //At least one side is hashed, both are the same kind (maps, multimaps or either with either, the same for sets) and the keys of one
+    //convert into the other's key_type
+    template <class Comparable1, class Comparable2>
+    struct is_lookup_comparable
+        : std::conjunction<std::bool_constant<(is_hashed<Comparable1>::value || is_hashed<Comparable2>::value)>,
+                           std::bool_constant<((is_unordered_map<Comparable1>::value || is_map<Comparable1>::value) &&
+                                               (is_unordered_map<Comparable2>::value || is_map<Comparable2>::value)) ||
+                                              ((is_unordered_set<Comparable1>::value || is_set<Comparable1>::value) &&
+                                               (is_unordered_set<Comparable2>::value || is_set<Comparable2>::value))>,
+                           lookup_direction<Comparable1, Comparable2>> {};
+
+} //namespace isEqualDetail
+
+//this one is for tuple types specifically
+template <typename>      struct is_tuple                   : std::false_type {};
+template <typename ...T> struct is_tuple<std::tuple<T...>> : std::true_type  {};
+
+//try to leverage the same behavior for std::pair now
+template <typename>               struct is_pair                  : std::false_type {};
+template <typename T, typename V> struct is_pair<std::pair<T, V>> : std::true_type  {};
+
+//this one makes iterables more legible when using them in the source code
+template <typename T>
+using is_iterable = decltype(isEqualDetail::is_iterable_impl<T>(0));
+
+//and this one is for the ones that can only be walked once, without knowing how long they are up front. Hashed containers walk just as well,
+//but in no defined order, so lining one up position by position with anything else would depend on how it happened to be filled
+template <typename T>
+using is_single_pass_iterable = std::bool_constant<decltype(isEqualDetail::is_single_pass_iterable_impl<T>(0))::value && !isEqualDetail::is_hashed<T>::value>;
+
+//A tiny non-owning view over a pointer and a length, so raw buffers can be handed to isEqual without copying them into a container first
+template <typename T>
+class ArrayView{
+
+public:
+
+    constexpr ArrayView()
+        : dataPtr(nullptr),
+          count(0){
+
+        /* NOP */
+
+    }
+
+    constexpr ArrayView(T* dataIn, std::size_t countIn)
+        : dataPtr(dataIn),
+            count(countIn){
+
+        /* NOP */
+
+    }
+
+    constexpr T*          begin() const{ return dataPtr;         }
+    constexpr T*          end()   const{ return dataPtr + count; }
+    constexpr T*          data()  const{ return dataPtr;         }
+    constexpr std::size_t size()  const{ return count;           }
+
+private:
+
+    T*          dataPtr;
+    std::size_t count;
+
+};
+
+//Lets the element type be deduced, i.e. isEqual(makeArrayView(floatPtr, length), doubleVector)
+template <typename T>
+constexpr ArrayView<T> makeArrayView(T* data, std::size_t count){
+
+    return ArrayView<T>(data, count);
+
+}
+
+/*
+ * A non-owning view over every stride-th element from a pointer on, i.e. one column of a row-major matrix:
+ *     makeStridedView(matrix + column, rows, columns)
+ * Strides count elements (not bytes) and can be negative to walk backwards. It's random access, so it goes anywhere an iterable does,
+ * and a pair of them (or one with a contiguous range) gets compared in chunks gathered into the vectorized kernels.
+ */
+template <typename T>
+class StridedView{
+
+public:
+
+    //Holds the start and an index rather than a moving pointer, so an end iterator never points past what the view actually covers
+    class iterator{
+
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = std::remove_cv_t<T>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T*;
+        using reference         = T&;
+
+        constexpr iterator()
+            : start(nullptr),
+              index(0),
+              step(1){
+
+            /* NOP */
+
+        }
+
+        constexpr iterator(T* startIn, std::ptrdiff_t indexIn, std::ptrdiff_t stepIn)
+            : start(startIn),
+              index(indexIn),
+              step(stepIn){
+
+            /* NOP */
+
+        }
+
+        constexpr reference operator*()                          const{ return start[index * step];            }
+        constexpr pointer   operator->()                         const{ return start + index * step;           }
+        constexpr reference operator[](difference_type offset)   const{ return start[(index + offset) * step]; }
+
+        constexpr iterator& operator++()                              { ++index;          return *this;        }
+        constexpr iterator& operator--()                              { --index;          return *this;        }
+        constexpr iterator  operator++(int)                           { iterator previous = *this; ++index; return previous; }
+        constexpr iterator  operator--(int)                           { iterator previous = *this; --index; return previous; }
+        constexpr iterator& operator+=(difference_type offset)        { index += offset;  return *this;        }
+        constexpr iterator& operator-=(difference_type offset)        { index -= offset;  return *this;        }
+
+        constexpr iterator        operator+(difference_type offset)  const{ return iterator(start, index + offset, step); }
+        constexpr iterator        operator-(difference_type offset)  const{ return iterator(start, index - offset, step); }
+        constexpr difference_type operator-(const iterator& other)   const{ return index - other.index;                   }
+
+        friend constexpr iterator operator+(difference_type offset, const iterator& iter){ return iter + offset; }
+
+        constexpr bool operator==(const iterator& other) const{ return index == other.index; }
+        constexpr bool operator!=(const iterator& other) const{ return index != other.index; }
+        constexpr bool operator< (const iterator& other) const{ return index <  other.index; }
+        constexpr bool operator> (const iterator& other) const{ return index >  other.index; }
+        constexpr bool operator<=(const iterator& other) const{ return index <= other.index; }
+        constexpr bool operator>=(const iterator& other) const{ return index >= other.index; }
+
+    private:
+
+        T*             start;
+        std::ptrdiff_t index;
+        std::ptrdiff_t step;
+
+    };
+
+    constexpr StridedView()
+        : start(nullptr),
+          count(0),
+          step(1){
+
+        /* NOP */
+
+    }
+
+    constexpr StridedView(T* startIn, std::size_t countIn, std::ptrdiff_t stepIn)
+        : start(startIn),
+          count(countIn),
+          step(stepIn){
+
+        /* NOP */
+
+    }
+
+    constexpr iterator       begin()                       const{ return iterator(start, 0, step);                                  }
+    constexpr iterator       end()                         const{ return iterator(start, static_cast<std::ptrdiff_t>(count), step); }
+    constexpr T&             operator[](std::size_t index) const{ return start[static_cast<std::ptrdiff_t>(index) * step];          }
+    constexpr T*             base()                        const{ return start;                                                     }
+    constexpr std::size_t    size()                        const{ return count;                                                     }
+    constexpr std::ptrdiff_t stride()                      const{ return step;                                                      }
+
+private:
+
+    //No data() on purpose, that would make every stride look contiguous to the rest of isEqual
+    T*             start;
+    std::size_t    count;
+    std::ptrdiff_t step;
+
+};
+
+template <typename T>
+constexpr StridedView<T> makeStridedView(T* start, std::size_t count, std::ptrdiff_t stride){
+
+    return StridedView<T>(start, count, stride);
+
+}
+
+/*
+ * A non-owning 2D view in the spirit of std::mdspan with a layout_stride mapping, element (row, column) being
+ * base[row * rowStride + column * columnStride]. Row-major, column-major, transposed, single rows and columns and blocks of
+ * a bigger matrix are all just different strides of the same memory, so none of them ever need a copy.
+ * Two of them compare element by element at the same (row, column), whatever their layouts (see compareMatrixViews).
+ */
+template <typename T>
+class MatrixView{
+
+public:
+
+    constexpr MatrixView(T* startIn, std::size_t rowCountIn, std::size_t columnCountIn, std::ptrdiff_t rowStepIn, std::ptrdiff_t columnStepIn)
+        : start(startIn),
+          rowCount(rowCountIn),
+          columnCount(columnCountIn),
+          rowStep(rowStepIn),
+          columnStep(columnStepIn){
+
+        /* NOP */
+
+    }
+
+    static constexpr MatrixView rowMajor(T* start, std::size_t rows, std::size_t columns){
+
+        return MatrixView(start, rows, columns, static_cast<std::ptrdiff_t>(columns), 1);
+
+    }
+
+    static constexpr MatrixView columnMajor(T* start, std::size_t rows, std::size_t columns){
+
+        return MatrixView(start, rows, columns, 1, static_cast<std::ptrdiff_t>(rows));
+
+    }
+
+    constexpr T&             operator()(std::size_t row, std::size_t column) const{ return start[offset(row, column)];        }
+    constexpr T*             base()                                          const{ return start;                             }
+    constexpr std::size_t    rows()                                          const{ return rowCount;                          }
+    constexpr std::size_t    columns()                                       const{ return columnCount;                       }
+    constexpr std::ptrdiff_t rowStride()                                     const{ return rowStep;                           }
+    constexpr std::ptrdiff_t columnStride()                                  const{ return columnStep;                        }
+
+    constexpr StridedView<T> row(std::size_t row)       const{ return StridedView<T>(start + offset(row, 0), columnCount, columnStep); }
+    constexpr StridedView<T> column(std::size_t column) const{ return StridedView<T>(start + offset(0, column), rowCount, rowStep);    }
+    constexpr MatrixView     transposed()               const{ return MatrixView(start, columnCount, rowCount, columnStep, rowStep);   }
+
+    constexpr MatrixView block(std::size_t firstRow, std::size_t firstColumn, std::size_t rows, std::size_t columns) const{
+
+        return MatrixView(start + offset(firstRow, firstColumn), rows, columns, rowStep, columnStep);
+
+    }
+
+private:
+
+    constexpr std::ptrdiff_t offset(std::size_t row, std::size_t column) const{
+
+        return static_cast<std::ptrdiff_t>(row) * rowStep + static_cast<std::ptrdiff_t>(column) * columnStep;
+
+    }
+
+    T*             start;
+    std::size_t    rowCount;
+    std::size_t    columnCount;
+    std::ptrdiff_t rowStep;
+    std::ptrdiff_t columnStep;
+
+};
+
+namespace isEqualDetail{
+
+    //Round to nearest even, like the F16C instructions do. Overflow goes to infinity and NaNs stay (quiet) NaNs.
+    inline std::uint16_t floatToHalfBits(float value){
+
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        std::uint32_t sign      = (bits >> 16) & 0x8000u;
+        std::uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+        if(magnitude >= 0x7F800000u){
+
+            return static_cast<std::uint16_t>(sign | (magnitude > 0x7F800000u ? 0x7E00u | ((magnitude >> 13) & 0x3FFu) : 0x7C00u));
+
+        }
+
+        //65520 and up round past the largest half (65504)
+        if(magnitude >= 0x477FF000u){
+
+            return static_cast<std::uint16_t>(sign | 0x7C00u);
+
+        }
+
+        //Below the smallest normal half, adding 0.5 lines the float's last mantissa bit up with the half's subnormal step, so the FPU does the rounding
+        if(magnitude < 0x38800000u){
+
+            float subnormal;
+            std::memcpy(&subnormal, &magnitude, sizeof(subnormal));
+            subnormal += 0.5f;
+            std::memcpy(&magnitude, &subnormal, sizeof(magnitude));
+
+            return static_cast<std::uint16_t>(sign | (magnitude - 0x3F000000u));
+
+        }
+
+        //Rebias the exponent (127 - 15) and round the 13 dropped mantissa bits to nearest even
+        return static_cast<std::uint16_t>(sign | ((magnitude + 0xC8000FFFu + ((magnitude >> 13) & 1u)) >> 13));
+
+    }
+
+    //Exact, every half is a float
+    inline float halfBitsToFloat(std::uint16_t half){
+
+        std::uint32_t sign     = static_cast<std::uint32_t>(half & 0x8000u) << 16;
+        std::uint32_t exponent = (half >> 10) & 0x1Fu;
+        std::uint32_t mantissa = half & 0x3FFu;
+        std::uint32_t bits;
+
+        if(exponent == 0){
+
+            //Zeros and subnormals are mantissa * 2^-24, which a float holds exactly
+            float subnormal = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+            return sign ? -subnormal : subnormal;
+
+        }
+        else if(exponent == 0x1Fu){
+
+            bits = sign | 0x7F800000u | (mantissa << 13);
+
+        }
+        else{
+
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+        }
+
+        float widened;
+        std::memcpy(&widened, &bits, sizeof(widened));
+
+        return widened;
+
+    }
+
+    //bfloat16 is the top half of a float, so narrowing is rounding away the bottom 16 bits (to nearest even, NaNs kept quiet)
+    inline std::uint16_t floatToBFloat16Bits(float value){
+
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        if((bits & 0x7FFFFFFFu) > 0x7F800000u){
+
+            return static_cast<std::uint16_t>((bits >> 16) | 0x40u);
+
+        }
+
+        return static_cast<std::uint16_t>((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16);
+
+    }
+
+    //Keeps GCC's default -ffp-contract=fast from fusing the multiply that produced value into whatever subtraction comes next, which
+    //would skip the rounding in between and let the scalar loop and the kernels (built for different targets) disagree in the last bit
+    template <typename T>
+    inline void roundHere(T& value){
+
+        #if defined(__GNUC__) && defined(__x86_64__)
+
+        asm("" : "+x"(value));
+
+        #else
+
+        (void) value;
+
+        #endif
+
+    }
+
+    inline float bfloat16BitsToFloat(std::uint16_t bfloat16){
+
+        std::uint32_t bits = static_cast<std::uint32_t>(bfloat16) << 16;
+
+        float widened;
+        std::memcpy(&widened, &bits, sizeof(widened));
+
+        return widened;
+
+    }
+
+} //namespace isEqualDetail
+
+/*
+ * IEEE 754 half precision (binary16) and bfloat16 values, kept as their 16 raw bits the way checkpoints and activations store them.
+ * Every one of their values is exactly a float, so isEqual compares them as the floats they widen to, against each other or against
+ * any number, with any tolerance policy (ULPs included, which are then float ULPs). Contiguous runs of them against runs of floats or
+ * doubles get widened in registers by the kernels (F16C or AVX-512 for halves, a shift for bfloat16) instead of element by element.
+ */
+struct Float16{
+
+    std::uint16_t bits = 0;
+
+    Float16() = default;
+
+    explicit Float16(float value)
+        : bits(isEqualDetail::floatToHalfBits(value)){
+
+        /* NOP */
+
+    }
+
+    static constexpr Float16 fromBits(std::uint16_t bitsIn){ Float16 half; half.bits = bitsIn; return half; }
+
+    float toFloat() const{ return isEqualDetail::halfBitsToFloat(bits); }
+
+};
+
+struct BFloat16{
+
+    std::uint16_t bits = 0;
+
+    BFloat16() = default;
+
+    explicit BFloat16(float value)
+        : bits(isEqualDetail::floatToBFloat16Bits(value)){
+
+        /* NOP */
+
+    }
+
+    static constexpr BFloat16 fromBits(std::uint16_t bitsIn){ BFloat16 bfloat16; bfloat16.bits = bitsIn; return bfloat16; }
+
+    float toFloat() const{ return isEqualDetail::bfloat16BitsToFloat(bits); }
+
+};
+
+inline std::ostream& operator<<(std::ostream& stream, const Float16&  half)    { return stream << half.toFloat();     }
+inline std::ostream& operator<<(std::ostream& stream, const BFloat16& bfloat16){ return stream << bfloat16.toFloat(); }
+
+/*
+ * A non-owning view over quantized integers (int8 or uint8 weights, say), element i standing for (values[i] - zeroPoint) * scale,
+ * worked out in float like the frameworks writing them do. The zero point has to be a value of the integer type, as it always is.
+ * It iterates as those floats, so it goes anywhere an iterable does, and against a contiguous run of floats or doubles it gets
+ * dequantized in registers by the kernels instead of being widened into a std::vector<float> first.
+ */
+template <typename Integer>
+class QuantizedView{
+
+public:
+
+    static_assert(std::is_integral_v<Integer> && sizeof(Integer) <= 2, "QuantizedView holds 8 or 16 bit integers");
+
+    class iterator{
+
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = float;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = float;
+
+        constexpr iterator()
+            : start(nullptr),
+              index(0),
+              scaleFactor(1.0f),
+              zero(0){
+
+            /* NOP */
+
+        }
+
+        constexpr iterator(const Integer* startIn, std::ptrdiff_t indexIn, float scaleIn, std::int32_t zeroPointIn)
+            : start(startIn),
+              index(indexIn),
+              scaleFactor(scaleIn),
+              zero(zeroPointIn){
+
+            /* NOP */
+
+        }
+
+        reference           operator*()                          const{ return dequantize(start[index], scaleFactor, zero);          }
+        reference           operator[](difference_type offset)   const{ return dequantize(start[index + offset], scaleFactor, zero); }
+
+        constexpr iterator& operator++()                              { ++index;          return *this;        }
+        constexpr iterator& operator--()                              { --index;          return *this;        }
+        constexpr iterator  operator++(int)                           { iterator previous = *this; ++index; return previous; }
+        constexpr iterator  operator--(int)                           { iterator previous = *this; --index; return previous; }
+        constexpr iterator& operator+=(difference_type offset)        { index += offset;  return *this;        }
+        constexpr iterator& operator-=(difference_type offset)        { index -= offset;  return *this;        }
+
+        constexpr iterator        operator+(difference_type offset)  const{ return iterator(start, index + offset, scaleFactor, zero); }
+        constexpr iterator        operator-(difference_type offset)  const{ return iterator(start, index - offset, scaleFactor, zero); }
+        constexpr difference_type operator-(const iterator& other)   const{ return index - other.index;                                }
+
+        friend constexpr iterator operator+(difference_type offset, const iterator& iter){ return iter + offset; }
+
+        constexpr bool operator==(const iterator& other) const{ return index == other.index; }
+        constexpr bool operator!=(const iterator& other) const{ return index != other.index; }
+        constexpr bool operator< (const iterator& other) const{ return index <  other.index; }
+        constexpr bool operator> (const iterator& other) const{ return index >  other.index; }
+        constexpr bool operator<=(const iterator& other) const{ return index <= other.index; }
+        constexpr bool operator>=(const iterator& other) const{ return index >= other.index; }
+
+    private:
+
+        const Integer* start;
+        std::ptrdiff_t index;
+        float          scaleFactor;
+        std::int32_t   zero;
+
+    };
+
+    constexpr QuantizedView(const Integer* startIn, std::size_t countIn, float scaleIn, std::int32_t zeroPointIn = 0)
+        : start(startIn),
+          count(countIn),
+          scaleFactor(scaleIn),
+          zero(zeroPointIn){
+
+        /* NOP */
+
+    }
+
+    constexpr iterator       begin()                       const{ return iterator(start, 0, scaleFactor, zero);                                   }
+    constexpr iterator       end()                         const{ return iterator(start, static_cast<std::ptrdiff_t>(count), scaleFactor, zero); }
+    float                    operator[](std::size_t index) const{ return dequantize(start[index], scaleFactor, zero);                         }
+    constexpr const Integer* values()                      const{ return start;                                                               }
+    constexpr std::size_t    size()                        const{ return count;                                                               }
+    constexpr float          scale()                       const{ return scaleFactor;                                                         }
+    constexpr std::int32_t   zeroPoint()                   const{ return zero;                                                                }
+
+    //The one place the arithmetic lives, the kernels do exactly this (a subtraction in int32, then one rounded float multiply) in every lane
+    static float dequantize(Integer value, float scale, std::int32_t zeroPoint){
+
+        float dequantized = static_cast<float>(static_cast<std::int32_t>(value) - zeroPoint) * scale;
+        isEqualDetail::roundHere(dequantized);
+
+        return dequantized;
+
+    }
+
+private:
+
+    //No data() on purpose, the raw integers are nothing like the numbers they stand for
+    const Integer* start;
+    std::size_t    count;
+    float          scaleFactor;
+    std::int32_t   zero;
+
+};
+
+template <typename Integer>
+constexpr QuantizedView<Integer> makeQuantizedView(const Integer* values, std::size_t count, float scale, std::int32_t zeroPoint = 0){
+
+    return QuantizedView<Integer>(values, count, scale, zeroPoint);
+
+}
+
+//The following was found at: https://www.fluentcpp.com/2019/03/08/stl-algorithms-on-tuples/
+//This allows us to generically iterate over two tuples simulatenously and perform user-defined operations on it (super cool)
+template <class Tuple1, class Tuple2, class F, std::size_t... I>
+constexpr F for_each_tuple_element_impl(Tuple1&& t1, Tuple2&& t2, F&& f, std::index_sequence<I...>)
+{
+    return (void)std::initializer_list<int>{(std::forward<F>(f)(std::get<I>(std::forward<Tuple1>(t1)), std::get<I>(std::forward<Tuple2>(t2))),0)...}, f;
+}
+
+template <class Tuple1, class Tuple2, class F>
+constexpr decltype(auto) for_each_tuple_element(Tuple1&& t1, Tuple2&& t2, F&& f)
+{
+    return for_each_tuple_element_impl(std::forward<Tuple1>(t1), std::forward<Tuple2>(t2), std::forward<F>(f),
+                         std::make_index_sequence<std::tuple_size<std::remove_reference_t<Tuple1>>::value>{});
+}
+
+
+namespace isEqualDetail{
+
+    //The largest float that's <= value. A float difference is <= value exactly when it's <= this, so float pairs never have to widen
+    constexpr float roundDownToFloat(double value){
+
+        if(!(value >= 0)){
+
+            //Negative tolerances let nothing through, and NaN stays NaN
+            return value < 0 ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
+
+        }
+
+        if(value > std::numeric_limits<float>::max()){
+
+            return value == std::numeric_limits<double>::infinity() ? std::numeric_limits<float>::infinity() : std::numeric_limits<float>::max();
+
+        }
+
+        float rounded = static_cast<float>(value);
+
+        if(rounded <= value){
+
+            return rounded;
+
+        }
+
+        //One step down. For normal floats, multiplying by the largest float below 1 rounds to exactly the next float down
+        //(or lands on it exactly for powers of two). Below that the floats are evenly spaced by denorm_min.
+        return rounded > std::numeric_limits<float>::min() ? rounded * (1.0f - std::numeric_limits<float>::epsilon() / 2)
+                                                           : rounded - std::numeric_limits<float>::denorm_min();
+
+    }
+
+    //floor(value) for a non-negative value, saturated to what fits, so integer pairs can check their distance without leaving integers
+    constexpr std::uint64_t floorToUnsigned(double value){
+
+        if(!(value >= 0)){
+
+            return 0;
+
+        }
+
+        return value >= 18446744073709551616.0 ? std::numeric_limits<std::uint64_t>::max() : static_cast<std::uint64_t>(value);
+
+    }
+
+} //namespace isEqualDetail
+
+/*
+ * Tolerance policies, picked by type so each comparison compiles down to just the arithmetic its policy and its pair of types need.
+ * Anywhere a tolerance is taken a plain number still works, and means an AbsoluteTolerance of that much (so isEqual(a, b, 1E-5) is
+ * exactly what it always was, minus the detour through float the tolerance used to take).
+ */
+
+//Equal, full stop. Integers compare exactly (even with mixed signedness), floating point with == so -0.0 matches 0.0 and NaN matches nothing
+struct ExactTolerance{};
+
+//|a - b| <= value
+struct AbsoluteTolerance{
+
+    constexpr explicit AbsoluteTolerance(double valueIn)
+        :          value(valueIn),
+              floatValue(isEqualDetail::roundDownToFloat(valueIn)),
+            integerValue(isEqualDetail::floorToUnsigned(valueIn)),
+          integerAllowed(valueIn >= 0){
+
+        /* NOP */
+
+    }
+
+public:
+
+    double        value;
+    float         floatValue;       //what float pairs compare against, see roundDownToFloat
+    std::uint64_t integerValue;     //what integer pairs compare their distance against
+    bool          integerAllowed;   //false for negative (or NaN) tolerances, which not even two equal integers are within
+
+};
+
+//|a - b| <= value * max(|a|, |b|)
+struct RelativeTolerance{
+
+    constexpr explicit RelativeTolerance(double valueIn)
+        : value(valueIn){
+
+        /* NOP */
+
+    }
+
+public:
+
+    double value;
+
+};
+
+//At most maxUlps representable values apart. Mixed float/double pairs count in double ULPs, integers against floating point values get
+//rounded to the floating type first, and integer pairs count every integer as one ULP. Needs memcpy, so this one can't run at compile time.
+struct UlpTolerance{
+
+    constexpr explicit UlpTolerance(std::uint64_t maxUlpsIn)
+        : maxUlps(maxUlpsIn){
+
+        /* NOP */
+
+    }
+
+public:
+
+    std::uint64_t maxUlps;
+
+};
+
+//Within either one, the usual fix for relative tolerances falling apart around zero
+struct AbsRelTolerance{
+
+    constexpr AbsRelTolerance(double absoluteIn, double relativeIn)
+        : absolute(absoluteIn),
+          relative(relativeIn){
+
+        /* NOP */
+
+    }
+
+public:
+
+    AbsoluteTolerance absolute;
+    RelativeTolerance relative;
+
+};
+
+//Contiguous ranges of arithmetic types (std::vector<float>, std::array<double, N>, C arrays, ArrayViews, spans...) skip the per-element
+//recursion entirely and get handed to the kernels below as two raw pointers and a length
+namespace isEqualDetail{
+
+    using std::data;
+
+    template <typename T>
+    constexpr auto adlData(const T& contiguous) -> decltype(data(contiguous)){
+
+        return data(contiguous);
+
+    }
+
+    template <typename T>
+    auto is_contiguous_arithmetic_impl(int)
+    -> decltype (
+        size(std::declval<const T&>()),
+        std::bool_constant<std::is_pointer_v<decltype(data(std::declval<const T&>()))> &&
+                           std::is_arithmetic_v<std::remove_pointer_t<decltype(data(std::declval<const T&>()))>>>{});
+
+    template <typename T>
+    std::false_type is_contiguous_arithmetic_impl(...);
+
+    //Same idea without caring what the elements are, the element type comes along so two sides can be checked for being the exact same one
+    template <typename T>
+    auto is_contiguous_impl(int)
+    -> decltype (
+        size(std::declval<const T&>()),
+        std::bool_constant<std::is_pointer_v<decltype(data(std::declval<const T&>()))>>{});
+
+    template <typename T>
+    std::false_type is_contiguous_impl(...);
+
+    template <typename T>
+    using contiguous_element_t = std::remove_cv_t<std::remove_pointer_t<decltype(data(std::declval<const T&>()))>>;
+
+    //Lets the constexpr paths below steer clear of memcmp and the vectorized kernels, neither of which can run at compile time
+    constexpr bool isConstantEvaluated(){
+
+        #if defined(__cpp_lib_is_constant_evaluated)
+
+        return std::is_constant_evaluated();
+
+        #elif defined(__GNUC__)
+
+        return __builtin_is_constant_evaluated();
+
+        #else
+
+        return false;
+
+        #endif
+
+    }
+
+    //|integer1 - integer2| without ever overflowing (or widening past 64 bits). The one pair that can't fit, a huge unsigned value
+    //against a negative one, saturates, which is still further apart than any tolerance an integer can be compared against.
+    template <typename Integer1, typename Integer2>
+    constexpr std::uint64_t integerDistance(Integer1 integer1, Integer2 integer2){
+
+        if constexpr(std::is_signed_v<Integer1> == std::is_signed_v<Integer2>){
+
+            using Wide = std::conditional_t<std::is_signed_v<Integer1>, std::int64_t, std::uint64_t>;
+
+            Wide wide1 = static_cast<Wide>(integer1);
+            Wide wide2 = static_cast<Wide>(integer2);
+
+            return wide1 < wide2 ? static_cast<std::uint64_t>(wide2) - static_cast<std::uint64_t>(wide1)
+                                 : static_cast<std::uint64_t>(wide1) - static_cast<std::uint64_t>(wide2);
+
+        }
+        else if constexpr(std::is_signed_v<Integer1>){
+
+            return integerDistance(integer2, integer1);
+
+        }
+        else{
+
+            std::uint64_t unsigned1 = static_cast<std::uint64_t>(integer1);
+            std::int64_t  signed2   = static_cast<std::int64_t>(integer2);
+
+            //|signed2| spelled so it can't overflow on the most negative value
+            std::uint64_t magnitude2 = static_cast<std::uint64_t>(-(signed2 + 1)) + 1;
+
+            if(signed2 >= 0){
+
+                return integerDistance(unsigned1, static_cast<std::uint64_t>(signed2));
+
+            }
+
+            return unsigned1 > std::numeric_limits<std::uint64_t>::max() - magnitude2 ? std::numeric_limits<std::uint64_t>::max() : unsigned1 + magnitude2;
+
+        }
+
+    }
+
+    template <typename Floating>
+    constexpr Floating absoluteValue(Floating floating){
+
+        return floating < 0 ? -floating : floating;
+
+    }
+
+    //|integer - floating| for the integers too wide for any floating type to hold exactly (64 bit ones against a double, say).
+    //The floating value gets split into a whole part, which is compared against the integer exactly, and its fraction, so the
+    //result is exact whenever the two are close, which is the only time it matters. Anything outside the integer's range is far
+    //enough away that a plain double difference is plenty, and NaN stays NaN.
+    template <typename Integer, typename Floating>
+    constexpr double splitDistance(Integer integer, Floating floating){
+
+        using Wide = std::conditional_t<std::is_signed_v<Integer>, std::int64_t, std::uint64_t>;
+
+        constexpr Floating wideMin = std::is_signed_v<Integer> ? Floating(-9223372036854775808.0) : Floating(0);
+        constexpr Floating wideEnd = std::is_signed_v<Integer> ? Floating(9223372036854775808.0)  : Floating(18446744073709551616.0);
+
+        if(!(wideMin <= floating && floating < wideEnd)){
+
+            return absoluteValue(static_cast<double>(integer) - static_cast<double>(floating));
+
+        }
+
+        Wide   whole    = static_cast<Wide>(floating);
+        double fraction = static_cast<double>(floating - static_cast<Floating>(whole));
+        double distance = static_cast<double>(integerDistance(static_cast<Wide>(integer), whole));
+
+        //integer - floating == (integer - whole) - fraction, and |integer - whole| is at least 1 whenever integer < whole
+        return static_cast<Wide>(integer) >= whole ? absoluteValue(distance - fraction) : distance + fraction;
+
+    }
+
+    //The narrowest floating type a pair gets compared in: floating pairs use the wider of the two, and integers go in the narrowest
+    //floating type that holds every one of their values exactly (void means none does, see splitDistance). Two integers never get
+    //compared in floating point, the double is just for relative tolerances scaling by their magnitude.
+    template <typename Arithmetic1, typename Arithmetic2>
+    struct difference_type{
+
+        template <typename Integer, typename Floating>
+        static auto pick(){
+
+            constexpr int integerDigits = std::numeric_limits<Integer>::digits;
+
+            if constexpr(integerDigits <= std::numeric_limits<Floating>::digits)  return Floating();
+            else if constexpr(integerDigits <= std::numeric_limits<double>::digits) return std::common_type_t<Floating, double>();
+
+        }
+
+        static auto pick(){
+
+            if constexpr(std::is_floating_point_v<Arithmetic1> && std::is_floating_point_v<Arithmetic2>) return std::common_type_t<Arithmetic1, Arithmetic2>();
+            else if constexpr(std::is_floating_point_v<Arithmetic2>)                                       return pick<Arithmetic1, Arithmetic2>();
+            else if constexpr(std::is_floating_point_v<Arithmetic1>)                                       return pick<Arithmetic2, Arithmetic1>();
+            else                                                                                           return double();
+
+        }
+
+        using type = decltype(pick());
+
+    };
+
+    template <typename Arithmetic1, typename Arithmetic2>
+    using difference_t = typename difference_type<Arithmetic1, Arithmetic2>::type;
+
+    //|fundamental1 - fundamental2| for every pair that isn't two integers, in difference_t (or double, for the split case)
+    template <typename Fundamental1, typename Fundamental2>
+    constexpr auto absoluteDifference(const Fundamental1& fundamental1, const Fundamental2& fundamental2){
+
+        using Difference = difference_t<Fundamental1, Fundamental2>;
+
+        if constexpr(std::is_void_v<Difference>){
+
+            if constexpr(std::is_integral_v<Fundamental1>) return splitDistance(fundamental1, fundamental2);
+            else                                          return splitDistance(fundamental2, fundamental1);
+
+        }
+        else{
+
+            return absoluteValue(static_cast<Difference>(fundamental1) - static_cast<Difference>(fundamental2));
+
+        }
+
+    }
+
+    //The larger magnitude of the two, in the same type absoluteDifference answers in
+    template <typename Fundamental1, typename Fundamental2>
+    constexpr auto largerMagnitude(const Fundamental1& fundamental1, const Fundamental2& fundamental2){
+
+        using Difference = std::conditional_t<std::is_void_v<difference_t<Fundamental1, Fundamental2>>, double, difference_t<Fundamental1, Fundamental2>>;
+
+        Difference magnitude1 = absoluteValue(static_cast<Difference>(fundamental1));
+        Difference magnitude2 = absoluteValue(static_cast<Difference>(fundamental2));
+
+        return magnitude1 < magnitude2 ? magnitude2 : magnitude1;
+
+    }
+
+    //Floating point bits mapped onto a line where neighbouring values are neighbouring integers (and -0.0 lands on 0.0)
+    template <typename Floating>
+    inline std::int64_t orderedBits(Floating floating){
+
+        using Bits = std::conditional_t<sizeof(Floating) == 4, std::int32_t, std::int64_t>;
+
+        Bits bits;
+        std::memcpy(&bits, &floating, sizeof(bits));
+
+        return bits < 0 ? -static_cast<std::int64_t>(bits & std::numeric_limits<Bits>::max()) : static_cast<std::int64_t>(bits);
+
+    }
+
+    /*
+     * The one place the fundamental tolerance checks live, so the scalar loop, the vectorized kernels and isEqual itself can't drift apart.
+     * There's one per policy, and each one picks the cheapest arithmetic that's still exact for the pair of types it's handed:
+     *  - two integers never leave integers, their distance is taken without overflowing and compared against an integer bound
+     *  - two floats stay in float, two doubles in double, and a float with a double goes to double (widening a float is exact)
+     *  - an integer with a floating value goes to the narrowest floating type that holds the integer exactly, or gets split (splitDistance)
+     * All of them are constant expressions, bar UlpTolerance.
+     */
+    template <typename Fundamental1, typename Fundamental2>
+    constexpr bool isWithinTolerance(const Fundamental1& fundamental1, const Fundamental2& fundamental2, const ExactTolerance&){
+
+        if constexpr(std::is_integral_v<Fundamental1> && std::is_integral_v<Fundamental2>){
+
+            return integerDistance(fundamental1, fundamental2) == 0;
+
+        }
+        else if constexpr(std::is_floating_point_v<Fundamental1> && std::is_floating_point_v<Fundamental2>){
+
+            return fundamental1 == fundamental2;
+
+        }
+        else{
+
+            return absoluteDifference(fundamental1, fundamental2) == 0;
+
+        }
+
+    }
+
+    template <typename Fundamental1, typename Fundamental2>
+    constexpr bool isWithinTolerance(const Fundamental1& fundamental1, const Fundamental2& fundamental2, const AbsoluteTolerance& tolerance){
+
+        if constexpr(std::is_integral_v<Fundamental1> && std::is_integral_v<Fundamental2>){
+
+            return tolerance.integerAllowed & (integerDistance(fundamental1, fundamental2) <= tolerance.integerValue);
+
+        }
+        else if constexpr(std::is_same_v<decltype(absoluteDifference(fundamental1, fundamental2)), float>){
+
+            return absoluteDifference(fundamental1, fundamental2) <= tolerance.floatValue;
+
+        }
+        else{
+
+            return absoluteDifference(fundamental1, fundamental2) <= tolerance.value;
+
+        }
+
+    }
+
+    template <typename Fundamental1, typename Fundamental2>
+    constexpr bool isWithinTolerance(const Fundamental1& fundamental1, const Fundamental2& fundamental2, const RelativeTolerance& tolerance){
+
+        if constexpr(std::is_integral_v<Fundamental1> && std::is_integral_v<Fundamental2>){
+
+            return static_cast<double>(integerDistance(fundamental1, fundamental2)) <= tolerance.value * largerMagnitude(fundamental1, fundamental2);
+
+        }
+        else{
+
+            using Difference = decltype(absoluteDifference(fundamental1, fundamental2));
+
+            return absoluteDifference(fundamental1, fundamental2) <= static_cast<Difference>(tolerance.value) * largerMagnitude(fundamental1, fundamental2);
+
+        }
+
+    }
+
+    template <typename Fundamental1, typename Fundamental2>
+    constexpr bool isWithinTolerance(const Fundamental1& fundamental1, const Fundamental2& fundamental2, const UlpTolerance& tolerance){
+
+        if constexpr(std::is_integral_v<Fundamental1> && std::is_integral_v<Fundamental2>){
+
+            return integerDistance(fundamental1, fundamental2) <= tolerance.maxUlps;
+
+        }
+        else{
+
+            //long double has padding (and no portable layout), so it's counted in double ULPs
+            using Difference = std::conditional_t<std::is_same_v<decltype(absoluteDifference(fundamental1, fundamental2)), float>, float, double>;
+
+            Difference value1 = static_cast<Difference>(fundamental1);
+            Difference value2 = static_cast<Difference>(fundamental2);
+
+            if(value1 != value1 || value2 != value2){
+
+                return false;
+
+            }
+
+            return integerDistance(orderedBits(value1), orderedBits(value2)) <= tolerance.maxUlps;
+
+        }
+
+    }
+
+    template <typename Fundamental1, typename Fundamental2>
+    constexpr bool isWithinTolerance(const Fundamental1& fundamental1, const Fundamental2& fundamental2, const AbsRelTolerance& tolerance){
+
+        return isWithinTolerance(fundamental1, fundamental2, tolerance.absolute) || isWithinTolerance(fundamental1, fundamental2, tolerance.relative);
+
+    }
+
+    //A plain number as the tolerance means an AbsoluteTolerance of that much, everything past the public entry points only ever sees a policy
+    template <typename Tolerance>
+    constexpr auto toTolerancePolicy(const Tolerance& tolerance){
+
+        if constexpr(std::is_arithmetic_v<Tolerance>){
+
+            return AbsoluteTolerance(static_cast<double>(tolerance));
+
+        }
+        else{
+
+            return tolerance;
+
+        }
+
+    }
+
+    /*
+     * Types where "equal according to isEqual" and "equal bytes" are the same thing, as long as the tolerance can't let two different integers
+     * through (an absolute one in [0, 1), an exact one, zero ULPs...):
+     * integers (two different integers are always at least 1 apart), enums (compared with their built-in ==), and std::arrays,
+     * C arrays, pairs and tuples made of nothing but those, provided there's no padding in the way (unique object representations).
+     * Floating point never qualifies, since 0.0 and -0.0 are equal and NaN isn't even equal to itself.
+     */
+    template <typename T>
+    struct is_bitwise_exact_element : std::bool_constant<std::is_integral_v<T> || std::is_enum_v<T>> {};
+
+    template <typename T, std::size_t N>
+    struct is_bitwise_exact_element<std::array<T, N>> : is_bitwise_exact_element<T> {};
+
+    template <typename T, std::size_t N>
+    struct is_bitwise_exact_element<T[N]> : is_bitwise_exact_element<T> {};
+
+    template <typename T, typename V>
+    struct is_bitwise_exact_element<std::pair<T, V>> : std::bool_constant<is_bitwise_exact_element<T>::value && is_bitwise_exact_element<V>::value> {};
+
+    template <typename ...T>
+    struct is_bitwise_exact_element<std::tuple<T...>> : std::bool_constant<(is_bitwise_exact_element<T>::value && ...)> {};
+
+    template <typename Element1, typename Element2>
+    struct is_bitwise_comparable : std::bool_constant<std::is_same_v<Element1, Element2>                    &&
+                                                      std::has_unique_object_representations_v<Element1> &&
+                                                      is_bitwise_exact_element<Element1>::value> {};
+
+    //Whether a policy lets two integers through only when they're identical
+    constexpr bool isBitwiseTolerance(const ExactTolerance&){
+
+        return true;
+
+    }
+
+    constexpr bool isBitwiseTolerance(const AbsoluteTolerance& tolerance){
+
+        return tolerance.integerAllowed && tolerance.integerValue == 0;
+
+    }
+
+    constexpr bool isBitwiseTolerance(const RelativeTolerance& tolerance){
+
+        //A negative one doesn't even let equal values through, which memcmp can't reproduce
+        return tolerance.value == 0;
+
+    }
+
+    constexpr bool isBitwiseTolerance(const UlpTolerance& tolerance){
+
+        return tolerance.maxUlps == 0;
+
+    }
+
+    constexpr bool isBitwiseTolerance(const AbsRelTolerance& tolerance){
+
+        return isBitwiseTolerance(tolerance.absolute) && !(tolerance.relative.value > 0);
+
+    }
+
+    //memcmp is about as fast as comparing memory gets, and won't accept a null pointer even for an empty range
+    template <typename Element>
+    inline bool compareBitwise(const Element* contiguous1, const Element* contiguous2, std::size_t count){
+
+        return count == 0 || std::memcmp(contiguous1, contiguous2, count * sizeof(Element)) == 0;
+
+    }
+
+    //The portable fallback, and the tail end of every vectorized kernel
+    template <typename Arithmetic1, typename Arithmetic2, typename Tolerance>
+    constexpr bool compareContiguousScalar(const Arithmetic1* contiguous1, const Arithmetic2* contiguous2, std::size_t count, const Tolerance& tolerance){
+
+        for(std::size_t index = 0; index < count; ++index){
+
+            if(!isWithinTolerance(contiguous1[index], contiguous2[index], tolerance)){
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    //Ordered from least to most capable, so a level can be compared against what the CPU reports
+    enum class SimdLevel{ Scalar, SSE2, AVX2, AVX512 };
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+    /*
+     * Every kernel below mirrors isWithinTolerance for an AbsoluteTolerance bit for bit:
+     *  - float/float subtracts in float and compares against the rounded down float tolerance, which gives the same answer
+     *    as comparing that float difference against the double tolerance
+     *  - float/double widens the float (again exact) and does everything else in double, just like the usual arithmetic conversions
+     *  - double/float is float/double with the operands swapped, which is fine since |a - b| and |b - a| round identically
+     *  - NaNs fail the ordered <= comparison, just like they do in isWithinTolerance
+     * Each loop handles 4 vectors per block, and bails out at the end of the first block with a failing lane.
+     */
+
+    inline bool compareFloatFloatSSE2(const float* contiguous1, const float* contiguous2, std::size_t count, const AbsoluteTolerance& tolerance){
+
+        const __m128 signMask     = _mm_set1_ps(-0.0f);
+        const __m128 toleranceVec = _mm_set1_ps(tolerance.floatValue);
+        std::size_t  index        = 0;
+
+        for(; index + 16 <= count; index += 16){
+
+            __m128 within0 = _mm_cmple_ps(_mm_andnot_ps(signMask, _mm_sub_ps(_mm_loadu_ps(contiguous1 + index),      _mm_loadu_ps(contiguous2 + index))),      toleranceVec);
+            __m128 within1 = _mm_cmple_ps(_mm_andnot_ps(signMask, _mm_sub_ps(_mm_loadu_ps(contiguous1 + index + 4),  _mm_loadu_ps(contiguous2 + index + 4))),  toleranceVec);
+            __m128 within2 = _mm_cmple_ps(_mm_andnot_ps(signMask, _mm_sub_ps(_mm_loadu_ps(contiguous1 + index + 8),  _mm_loadu_ps(contiguous2 + index + 8))),  toleranceVec);
+            __m128 within3 = _mm_cmple_ps(_mm_andnot_ps(signMask, _mm_sub_ps(_mm_loadu_ps(contiguous1 + index + 12), _mm_loadu_ps(contiguous2 + index + 12))), toleranceVec);
+
+            if(_mm_movemask_ps(_mm_and_ps(_mm_and_ps(within0, within1), _mm_and_ps(within2, within3))) != 0xF){
+
+                return false;
+
+            }
+
+        }
+
+        return compareContiguousScalar(contiguous1 + index, contiguous2 + index, count - index, tolerance);
+
+    }
+
+    inline bool compareFloatDoubleSSE2(const float* contiguous1, const double* contiguous2, std::size_t count, const AbsoluteTolerance& tolerance){
+
+        const __m128d signMask     = _mm_set1_pd(-0.0);
+        const __m128d toleranceVec = _mm_set1_pd(tolerance.value);
+        std::size_t   index        = 0;
+
+        //There's no 2-float load, so grab the low 64 bits and let cvtps_pd widen them
+        auto loadWidened = [](const float* floats){ return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(floats)))); };
+
+        for(; index + 8 <= count; index += 8){
+
+            __m128d within0 = _mm_cmple_pd(_mm_andnot_pd(signMask, _mm_sub_pd(loadWidened(contiguous1 + index),     _mm_loadu_pd(contiguous2 + index))),     toleranceVec);
+            __m128d within1 = _mm_cmple_pd(_mm_andnot_pd(signMask, _mm_sub_pd(loadWidened(contiguous1 + index + 2), _mm_loadu_pd(contiguous2 + index + 2))), toleranceVec);
+            __m128d within2 = _mm_cmple_pd(_mm_andnot_pd(signMask, _mm_sub_pd(loadWidened(contiguous1 + index + 4), _mm_loadu_pd(contiguous2 + index + 4))), toleranceVec);
+            __m128d within3 = _mm_cmple_pd(_mm_andnot_pd(signMask, _mm_sub_pd(loadWidened(contiguous1 + index + 6), _mm_loadu_pd(contiguous2 + index + 6))), toleranceVec);
+
+            if(_mm_movemask_pd(_mm_and_pd(_mm_and_pd(within0, within1), _mm_and_pd(within2, within3))) != 0x3){
+
+                return false;
+
+            }
+
+        }
+
+        return compareContiguousScalar(contiguous1 + index, contiguous2 + index, count - index, tolerance);
+
+    }
+
+    inline bool compareDoubleDoubleSSE2(const double* contiguous1, const double* contiguous2, std::size_t count, const AbsoluteTolerance& tolerance){
+
+        const __m128d signMask     = _mm_set1_pd(-0.0);
+        const __m128d toleranceVec = _mm_set1_pd(tolerance.value);
+        std::size_t   index        = 0;
+
+        for(; index + 8 <= count; index += 8){
+
+            __m128d within0 = _mm_cmple_pd(_mm_andnot_pd(signMask, _mm_sub_pd(_mm_loadu_pd(contiguous1 + index),     _mm_loadu_pd(contiguous2 + index))),     toleranceVec);
+            __m128d within1 = _mm_cmple_pd(_mm_andnot_pd(signMask, _mm_sub_pd(_mm_loadu_pd(contiguous1 + index + 2), _mm_loadu_pd(contiguous2 + index + 2))), toleranceVec);
+            __m128d within2 = _mm_cmple_pd(_mm_andnot_pd(signMask, _mm_sub_pd(_mm_loadu_pd(contiguous1 + index + 4), _mm_loadu_pd(contiguous2 + index + 4))), toleranceVec);
+            __m128d within3 = _mm_cmple_pd(_mm_andnot_pd(signMask, _mm_sub_pd(_mm_loadu_pd(contiguous1 + index + 6), _mm_loadu_pd(contiguous2 + index + 6))), toleranceVec);
+
+            if(_mm_movemask_pd(_mm_and_pd(_mm_and_pd(within0, within1), _mm_and_pd(within2, within3))) != 0x3){
+
+                return false;
+
+            }
+
+        }
+
+        return compareContiguousScalar(contiguous1 + index, contiguous2 + index, count - index, tolerance);
+
+    }
+
+    __attribute__((target("avx2")))
+    inline bool compareFloatFloatAVX2(const float* contiguous1, const float* contiguous2, std::size_t count, const AbsoluteTolerance& tolerance){
+
+        const __m256 signMask     = _mm256_set1_ps(-0.0f);
+        const __m256 toleranceVec = _mm256_set1_ps(tolerance.floatValue);
+        std::size_t  index        = 0;
+
+        for(; index + 32 <= count; index += 32){
+
+            __m256 within0 = _mm256_cmp_ps(_mm256_andnot_ps(signMask, _mm256_sub_ps(_mm256_loadu_ps(contiguous1 + index),      _mm256_loadu_ps(contiguous2 + index))),      toleranceVec, _CMP_LE_OQ);
+            __m256 within1 = _mm256_cmp_ps(_mm256_andnot_ps(signMask, _mm256_sub_ps(_mm256_loadu_ps(contiguous1 + index + 8),  _mm256_loadu_ps(contiguous2 + index + 8))),  toleranceVec, _CMP_LE_OQ);
+            __m256 within2 = _mm256_cmp_ps(_mm256_andnot_ps(signMask, _mm256_sub_ps(_mm256_loadu_ps(contiguous1 + index + 16), _mm256_loadu_ps(contiguous2 + index + 16))), toleranceVec, _CMP_LE_OQ);
+            __m256 within3 = _mm256_cmp_ps(_mm256_andnot_ps(signMask, _mm256_sub_ps(_mm256_loadu_ps(contiguous1 + index + 24), _mm256_loadu_ps(contiguous2 + index + 24))), toleranceVec, _CMP_LE_OQ);
+
+            if(_mm256_movemask_ps(_mm256_and_ps(_mm256_and_ps(within0, within1), _mm256_and_ps(within2, within3))) != 0xFF){
+
+                return false;
+
+            }
+
+        }
+
+        return compareContiguousScalar(contiguous1 + index, contiguous2 + index, count - index, tolerance);
+
+    }
+
+    __attribute__((target("avx2")))
+    inline bool compareFloatDoubleAVX2(const float* contiguous1, const double* contiguous2, std::size_t count, const AbsoluteTolerance& tolerance){
+
+        const __m256d signMask     = _mm256_set1_pd(-0.0);
+        const __m256d toleranceVec = _mm256_set1_pd(tolerance.value);
+        std::size_t   index        = 0;
+
+        for(; index + 16 <= count; index += 16){
+
+            __m256d within0 = _mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_cvtps_pd(_mm_loadu_ps(contiguous1 + index)),      _mm256_loadu_pd(contiguous2 + index))),      toleranceVec, _CMP_LE_OQ);
+            __m256d within1 = _mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_cvtps_pd(_mm_loadu_ps(contiguous1 + index + 4)),  _mm256_loadu_pd(contiguous2 + index + 4))),  toleranceVec, _CMP_LE_OQ);
+            __m256d within2 = _mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_cvtps_pd(_mm_loadu_ps(contiguous1 + index + 8)),  _mm256_loadu_pd(contiguous2 + index + 8))),  toleranceVec, _CMP_LE_OQ);
+            __m256d within3 = _mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_cvtps_pd(_mm_loadu_ps(contiguous1 + index + 12)), _mm256_loadu_pd(contiguous2 + index + 12))), toleranceVec, _CMP_LE_OQ);
+
+            if(_mm256_movemask_pd(_mm256_and_pd(_mm256_and_pd(within0, within1), _mm256_and_pd(within2, within3))) != 0xF){
+
+                return false;
+
+            }
+
+        }
+
+        return compareContiguousScalar(contiguous1 + index, contiguous2 + index, count - index, tolerance);
+
+    }
+
+    __attribute__((target("avx2")))
+    inline bool compareDoubleDoubleAVX2(const double* contiguous1, const double* contiguous2, std::size_t count, const AbsoluteTolerance& tolerance){
+
+        const __m256d signMask     = _mm256_set1_pd(-0.0);
+        const __m256d toleranceVec = _mm256_set1_pd(tolerance.value);
+        std::size_t   index        = 0;
+
+        for(; index + 16 <= count; index += 16){
+
+            __m256d within0 = _mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_loadu_pd(contiguous1 + index),      _mm256_loadu_pd(contiguous2 + index))),      toleranceVec, _CMP_LE_OQ);
+            __m256d within1 = _mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_loadu_pd(contiguous1 + index + 4),  _mm256_loadu_pd(contiguous2 + index + 4))),  toleranceVec, _CMP_LE_OQ);
+            __m256d within2 = _mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_loadu_pd(contiguous1 + index + 8),  _mm256_loadu_pd(contiguous2 + index + 8))),  toleranceVec, _CMP_LE_OQ);
+            __m256d within3 = _mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_loadu_pd(contiguous1 + index + 12), _mm256_loadu_pd(contiguous2 + index + 12))), toleranceVec, _CMP_LE_OQ);
+
+            if(_mm256_movemask_pd(_mm256_and_pd(_mm256_and_pd(within0, within1), _mm256_and_pd(within2, within3))) != 0xF){
+
+                return false;
+
+            }
+
+        }
+
+        return compareContiguousScalar(contiguous1 + index, contiguous2 + index, count - index, tolerance);
+
+    }
+
+    __attribute__((target("avx512f")))
+    inline bool compareFloatFloatAVX512(const float* contiguous1, const float* contiguous2, std::size_t count, const AbsoluteTolerance& tolerance){
+
+        const __m512 toleranceVec = _mm512_set1_ps(tolerance.floatValue);
+        std::size_t  index        = 0;
+
+        for(; index + 64 <= count; index += 64){
+
+            __mmask16 within0 = _mm512_cmp_ps_mask(_mm512_abs_ps(_mm512_sub_ps(_mm512_loadu_ps(contiguous1 + index),      _mm512_loadu_ps(contiguous2 + index))),      toleranceVec, _CMP_LE_OQ);
+            __mmask16 within1 = _mm512_cmp_ps_mask(_mm512_abs_ps(_mm512_sub_ps(_mm512_loadu_ps(contiguous1 + index + 16), _mm512_loadu_ps(contiguous2 + index + 16))), toleranceVec, _CMP_LE_OQ);
+            __mmask16 within2 = _mm512_cmp_ps_mask(_mm512_abs_ps(_mm512_sub_ps(_mm512_loadu_ps(contiguous1 + index + 32), _mm512_loadu_ps(contiguous2 + index + 32))), toleranceVec, _CMP_LE_OQ);
+            __mmask16 within3 = _mm512_cmp_ps_mask(_mm512_abs_ps(_mm512_sub_ps(_mm512_loadu_ps(contiguous1 + index + 48), _mm512_loadu_ps(contiguous2 + index + 48))), toleranceVec, _CMP_LE_OQ);
+
+            if((within0 & within1 & within2 & within3) != 0xFFFF){
+
+                return false;
+
+            }
+
+        }
+
+        return compareContiguousScalar(contiguous1 + index, contiguous2 + index, count - index, tolerance);
+
+    }
+
+    //The all-ones maskz widening is the plain one in disguise, it just keeps GCC from warning about the undefined register inside _mm512_cvtps_pd
+    __attribute__((target("avx512f")))
+    inline bool compareFloatDoubleAVX512(const float* contiguous1, const double* contiguous2, std::size_t count, const AbsoluteTolerance& tolerance){
+
+        const __m512d toleranceVec = _mm512_set1_pd(tolerance.value);
+        std::size_t   index        = 0;
+
+        for(; index + 32 <= count; index += 32){
+
+            __mmask8 within0 = _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_sub_pd(_mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(contiguous1 + index)),      _mm512_loadu_pd(contiguous2 + index))),      toleranceVec, _CMP_LE_OQ);
+            __mmask8 within1 = _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_sub_pd(_mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(contiguous1 + index + 8)),  _mm512_loadu_pd(contiguous2 + index + 8))),  toleranceVec, _CMP_LE_OQ);
+            __mmask8 within2 = _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_sub_pd(_mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(contiguous1 + index + 16)), _mm512_loadu_pd(contiguous2 + index + 16))), toleranceVec, _CMP_LE_OQ);
+            __mmask8 within3 = _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_sub_pd(_mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(contiguous1 + index + 24)), _mm512_loadu_pd(contiguous2 + index + 24))), toleranceVec, _CMP_LE_OQ);
+
+            if((within0 & within1 & within2 & within3) != 0xFF){
+
+                return false;
+
+            }
+
+        }
+
+        return compareContiguousScalar(contiguous1 + index, contiguous2 + index, count - index, tolerance);
+
+    }
+
+    __attribute__((target("avx512f")))
+    inline bool compareDoubleDoubleAVX512(const double* contiguous1, const double* contiguous2, std::size_t count, const AbsoluteTolerance& tolerance){
+
+        const __m512d toleranceVec = _mm512_set1_pd(tolerance.value);
+        std::size_t   index        = 0;
+
+        for(; index + 32 <= count; index += 32){
+
+            __mmask8 within0 = _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_sub_pd(_mm512_loadu_pd(contiguous1 + index),      _mm512_loadu_pd(contiguous2 + index))),      toleranceVec, _CMP_LE_OQ);
+            __mmask8 within1 = _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_sub_pd(_mm512_loadu_pd(contiguous1 + index + 8),  _mm512_loadu_pd(contiguous2 + index + 8))),  toleranceVec, _CMP_LE_OQ);
+            __mmask8 within2 = _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_sub_pd(_mm512_loadu_pd(contiguous1 + index + 16), _mm512_loadu_pd(contiguous2 + index + 16))), toleranceVec, _CMP_LE_OQ);
+            __mmask8 within3 = _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_sub_pd(_mm512_loadu_pd(contiguous1 + index + 24), _mm512_loadu_pd(contiguous2 + index + 24))), toleranceVec, _CMP_LE_OQ);
+
+            if((within0 & within1 & within2 & within3) != 0xFF){
+
+                return false;
+
+            }
+
+        }
+
+        return compareContiguousScalar(contiguous1 + index, contiguous2 + index, count - index, tolerance);
+
+    }
+
+    //Asked once per process, __builtin_cpu_supports also checks that the OS actually saves the wider registers
+    inline SimdLevel detectSimdLevel(){
+
+        static const SimdLevel detectedLevel = [](){
+
+            __builtin_cpu_init();
+
+            if(__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+            if(__builtin_cpu_supports("avx2"))    return SimdLevel::AVX2;
+
+            return SimdLevel::SSE2;
+
+        }();
+
+        return detectedLevel;
+
+    }
+
+#else
+
+    inline SimdLevel detectSimdLevel(){
+
+        return SimdLevel::Scalar;
+
+    }
+
+#endif //defined(__GNUC__) && defined(__x86_64__)
+
+    //Picks the widest kernel the CPU (or the caller, when forcing a narrower level to cross-check results) allows for this pair of element types.
+    //Only absolute tolerances (the default) have kernels, every other policy goes through its scalar check.
+    template <typename Arithmetic1, typename Arithmetic2, typename Tolerance>
+    inline bool compareContiguous(const Arithmetic1* contiguous1, const Arithmetic2* contiguous2, std::size_t count, const Tolerance& tolerance,
+                                  SimdLevel simdLevel = detectSimdLevel()){
+
+        #if defined(__GNUC__) && defined(__x86_64__)
+
+        constexpr bool hasKernels = std::is_same_v<Tolerance, AbsoluteTolerance>;
+
+        if constexpr(hasKernels && std::is_same_v<Arithmetic1, float> && std::is_same_v<Arithmetic2, float>){
+
+            switch(simdLevel){
+                case SimdLevel::AVX512: return compareFloatFloatAVX512(contiguous1, contiguous2, count, tolerance);
+                case SimdLevel::AVX2:   return compareFloatFloatAVX2  (contiguous1, contiguous2, count, tolerance);
+                case SimdLevel::SSE2:   return compareFloatFloatSSE2  (contiguous1, contiguous2, count, tolerance);
+                default:                break;
+            }
+
+        }
+        else if constexpr(hasKernels && std::is_same_v<Arithmetic1, float> && std::is_same_v<Arithmetic2, double>){
+
+            switch(simdLevel){
+                case SimdLevel::AVX512: return compareFloatDoubleAVX512(contiguous1, contiguous2, count, tolerance);
+                case SimdLevel::AVX2:   return compareFloatDoubleAVX2  (contiguous1, contiguous2, count, tolerance);
+                case SimdLevel::SSE2:   return compareFloatDoubleSSE2  (contiguous1, contiguous2, count, tolerance);
+                default:                break;
+            }
+
+        }
+        else if constexpr(hasKernels && std::is_same_v<Arithmetic1, double> && std::is_same_v<Arithmetic2, float>){
+
+            return compareContiguous(contiguous2, contiguous1, count, tolerance, simdLevel);
+
+        }
+        else if constexpr(hasKernels && std::is_same_v<Arithmetic1, double> && std::is_same_v<Arithmetic2, double>){
+
+            switch(simdLevel){
+                case SimdLevel::AVX512: return compareDoubleDoubleAVX512(contiguous1, contiguous2, count, tolerance);
+                case SimdLevel::AVX2:   return compareDoubleDoubleAVX2  (contiguous1, contiguous2, count, tolerance);
+                case SimdLevel::SSE2:   return compareDoubleDoubleSSE2  (contiguous1, contiguous2, count, tolerance);
+                default:                break;
+            }
+
+        }
+
+        #endif //defined(__GNUC__) && defined(__x86_64__)
+
+        (void) simdLevel;
+
+        return compareContiguousScalar(contiguous1, contiguous2, count, tolerance);
+
+    }
+
+    //One element of a run compareReducedRun walks: a number behind a plain pointer, a widened half or bfloat16, or a dequantized integer
+    template <typename Arithmetic>
+    constexpr Arithmetic reducedValue(const Arithmetic* values, std::size_t index){ return values[index]; }
+
+    inline float reducedValue(const Float16*  values, std::size_t index){ return values[index].toFloat(); }
+    inline float reducedValue(const BFloat16* values, std::size_t index){ return values[index].toFloat(); }
+
+    template <typename Integer>
+    inline float reducedValue(const QuantizedView<Integer>& view, std::size_t index){ return view[index]; }
+
+    //The portable fallback, and the tail end of every widening kernel. Widening is exact, so this is just isWithinTolerance on the floats.
+    template <typename Source1, typename Source2, typename Tolerance>
+    inline bool compareReducedScalar(const Source1& source1, const Source2& source2, std::size_t index, std::size_t end, const Tolerance& tolerance){
+
+        for(; index < end; ++index){
+
+            if(!isWithinTolerance(reducedValue(source1, index), reducedValue(source2, index), tolerance)){
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+    /*
+     * The widening kernels load a vector's worth of halves, bfloat16s or quantized integers, turn them into floats in registers
+     * (vcvtph2ps for halves, a zero extension and a 16 bit shift for bfloat16, a sign or zero extension, an int32 subtraction of the
+     * zero point and a float multiply for quantized values, which is exactly what QuantizedView::dequantize does) and then compare
+     * those floats against the reference run just like compareFloatFloat and compareFloatDouble do, so every answer matches the scalar loop.
+     */
+    __attribute__((target("avx2,f16c")))
+    inline __m256 widenAVX2(const Float16* values, std::size_t index){
+
+        return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index)));
+
+    }
+
+    //bfloat16s and quantized values need nothing past AVX2, so they keep the kernel even where F16C is missing (or hidden by a hypervisor)
+    __attribute__((target("avx2")))
+    inline __m256 widenAVX2(const BFloat16* values, std::size_t index){
+
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index))), 16));
+
+    }
+
+    template <typename Integer>
+    __attribute__((target("avx2")))
+    inline __m256 widenAVX2(const QuantizedView<Integer>& view, std::size_t index){
+
+        __m256i integers;
+
+        if constexpr(sizeof(Integer) == 1){
+
+            __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(view.values() + index));
+
+            if constexpr(std::is_signed_v<Integer>) integers = _mm256_cvtepi8_epi32(packed);
+            else                                    integers = _mm256_cvtepu8_epi32(packed);
+
+        }
+        else{
+
+            __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(view.values() + index));
+
+            if constexpr(std::is_signed_v<Integer>) integers = _mm256_cvtepi16_epi32(packed);
+            else                                    integers = _mm256_cvtepu16_epi32(packed);
+
+        }
+
+        __m256 dequantized = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(integers, _mm256_set1_epi32(view.zeroPoint()))), _mm256_set1_ps(view.scale()));
+        roundHere(dequantized);
+
+        return dequantized;
+
+    }
+
+    //Only the halves' widenAVX2 ever emits an F16C instruction, the rest of the kernel is plain AVX2
+    template <typename Source, typename Reference>
+    __attribute__((target("avx2,f16c")))
+    inline bool compareReducedAVX2(const Source& source, const Reference* reference, std::size_t index, std::size_t end, const AbsoluteTolerance& tolerance){
+
+        if constexpr(std::is_same_v<Reference, float>){
+
+            const __m256 signMask     = _mm256_set1_ps(-0.0f);
+            const __m256 toleranceVec = _mm256_set1_ps(tolerance.floatValue);
+
+            for(; index + 8 <= end; index += 8){
+
+                __m256 within = _mm256_cmp_ps(_mm256_andnot_ps(signMask, _mm256_sub_ps(widenAVX2(source, index), _mm256_loadu_ps(reference + index))), toleranceVec, _CMP_LE_OQ);
+
+                if(_mm256_movemask_ps(within) != 0xFF){
+
+                    return false;
+
+                }
+
+            }
+
+        }
+        else{
+
+            const __m256d signMask     = _mm256_set1_pd(-0.0);
+            const __m256d toleranceVec = _mm256_set1_pd(tolerance.value);
+
+            for(; index + 8 <= end; index += 8){
+
+                __m256  widened = widenAVX2(source, index);
+                __m256d within0 = _mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(widened)),  _mm256_loadu_pd(reference + index))),     toleranceVec, _CMP_LE_OQ);
+                __m256d within1 = _mm256_cmp_pd(_mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(widened, 1)), _mm256_loadu_pd(reference + index + 4))), toleranceVec, _CMP_LE_OQ);
+
+                if(_mm256_movemask_pd(_mm256_and_pd(within0, within1)) != 0xF){
+
+                    return false;
+
+                }
+
+            }
+
+        }
+
+        return compareReducedScalar(source, reference, index, end, tolerance);
+
+    }
+
+    //These use the zero masked forms with every lane set, which are the very same instructions, since GCC 12's headers build the
+    //unmasked ones on top of _mm512_undefined_* and -Wmaybe-uninitialized then fires on every one of them
+    constexpr __mmask16 all16 = 0xFFFF;
+
+    __attribute__((target("avx512f")))
+    inline __m512 widenAVX512(const Float16* values, std::size_t index){
+
+        return _mm512_maskz_cvtph_ps(all16, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index)));
+
+    }
+
+    __attribute__((target("avx512f")))
+    inline __m512 widenAVX512(const BFloat16* values, std::size_t index){
+
+        return _mm512_castsi512_ps(_mm512_maskz_slli_epi32(all16, _mm512_maskz_cvtepu16_epi32(all16, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index))), 16));
+
+    }
+
+    template <typename Integer>
+    __attribute__((target("avx512f")))
+    inline __m512 widenAVX512(const QuantizedView<Integer>& view, std::size_t index){
+
+        __m512i integers;
+
+        if constexpr(sizeof(Integer) == 1){
+
+            __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(view.values() + index));
+
+            if constexpr(std::is_signed_v<Integer>) integers = _mm512_maskz_cvtepi8_epi32(all16, packed);
+            else                                    integers = _mm512_maskz_cvtepu8_epi32(all16, packed);
+
+        }
+        else{
+
+            __m256i packed = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(view.values() + index));
+
+            if constexpr(std::is_signed_v<Integer>) integers = _mm512_maskz_cvtepi16_epi32(all16, packed);
+            else                                    integers = _mm512_maskz_cvtepu16_epi32(all16, packed);
+
+        }
+
+        __m512 dequantized = _mm512_mul_ps(_mm512_maskz_cvtepi32_ps(all16, _mm512_sub_epi32(integers, _mm512_set1_epi32(view.zeroPoint()))), _mm512_set1_ps(view.scale()));
+        roundHere(dequantized);
+
+        return dequantized;
+
+    }
+
+    template <typename Source, typename Reference>
+    __attribute__((target("avx512f")))
+    inline bool compareReducedAVX512(const Source& source, const Reference* reference, std::size_t index, std::size_t end, const AbsoluteTolerance& tolerance){
+
+        if constexpr(std::is_same_v<Reference, float>){
+
+            const __m512 toleranceVec = _mm512_set1_ps(tolerance.floatValue);
+
+            for(; index + 16 <= end; index += 16){
+
+                if(_mm512_cmp_ps_mask(_mm512_abs_ps(_mm512_sub_ps(widenAVX512(source, index), _mm512_loadu_ps(reference + index))), toleranceVec, _CMP_LE_OQ) != 0xFFFF){
+
+                    return false;
+
+                }
+
+            }
+
+        }
+        else{
+
+            const __m512d toleranceVec = _mm512_set1_pd(tolerance.value);
+
+            //No AVX512DQ needed to split the floats in two, each half gets moved over as 4 doubles' worth of bits
+            for(; index + 16 <= end; index += 16){
+
+                __m512   widened = widenAVX512(source, index);
+                __m256   lower   = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, _mm512_castps_pd(widened), 0));
+                __m256   upper   = _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, _mm512_castps_pd(widened), 1));
+                __mmask8 within0 = _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_sub_pd(_mm512_maskz_cvtps_pd(0xFF, lower), _mm512_loadu_pd(reference + index))),     toleranceVec, _CMP_LE_OQ);
+                __mmask8 within1 = _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_sub_pd(_mm512_maskz_cvtps_pd(0xFF, upper), _mm512_loadu_pd(reference + index + 8))), toleranceVec, _CMP_LE_OQ);
+
+                if((within0 & within1) != 0xFF){
+
+                    return false;
+
+                }
+
+            }
+
+        }
+
+        return compareReducedScalar(source, reference, index, end, tolerance);
+
+    }
+
+    //The AVX2 widening kernels need F16C on top, which every AVX2 CPU so far has had, but it's asked for anyway
+    inline bool detectF16C(){
+
+        static const bool detected = [](){
+
+            __builtin_cpu_init();
+
+            return __builtin_cpu_supports("f16c") != 0;
+
+        }();
+
+        return detected;
+
+    }
+
+#endif //defined(__GNUC__) && defined(__x86_64__)
+
+    //Elements [index, end) of a reduced run (see reducedValue) against another run, through the widest widening kernel the CPU (or the caller,
+    //when forcing a narrower level to cross-check results) allows. Only absolute tolerances against floats or doubles have kernels.
+    template <typename Source, typename Reference, typename Tolerance>
+    inline bool compareReducedRun(const Source& source, const Reference& reference, std::size_t index, std::size_t end, const Tolerance& tolerance,
+                                  SimdLevel simdLevel = detectSimdLevel()){
+
+        #if defined(__GNUC__) && defined(__x86_64__)
+
+        if constexpr(std::is_same_v<Tolerance, AbsoluteTolerance> && (std::is_same_v<Reference, const float*> || std::is_same_v<Reference, const double*>)){
+
+            //Halves are the only source that needs F16C to be widened at the AVX2 level
+            constexpr bool needsF16C = std::is_same_v<std::remove_cv_t<std::remove_pointer_t<Source>>, Float16>;
+
+            switch(simdLevel){
+                case SimdLevel::AVX512: return compareReducedAVX512(source, reference, index, end, tolerance);
+                case SimdLevel::AVX2:   if(!needsF16C || detectF16C()) return compareReducedAVX2(source, reference, index, end, tolerance); break;
+                default:                break;
+            }
+
+        }
+
+        #endif //defined(__GNUC__) && defined(__x86_64__)
+
+        (void) simdLevel;
+
+        return compareReducedScalar(source, reference, index, end, tolerance);
+
+    }
+
+} //namespace isEqualDetail
+
+//this one says whether something is laid out as one flat run of arithmetic values, which is what lets isEqual use the kernels above
+template <typename T>
+using is_contiguous_arithmetic = decltype(isEqualDetail::is_contiguous_arithmetic_impl<T>(0));
+
+//and this one whether it's one flat run of anything at all
+template <typename T>
+using is_contiguous = decltype(isEqualDetail::is_contiguous_impl<T>(0));
+
+namespace isEqualDetail{
+
+    template <typename>  struct is_reduced_float           : std::false_type {};
+    template <>          struct is_reduced_float<Float16>  : std::true_type  {};
+    template <>          struct is_reduced_float<BFloat16> : std::true_type  {};
+
+    template <typename>         struct is_quantized_view                         : std::false_type {};
+    template <typename Integer> struct is_quantized_view<QuantizedView<Integer>> : std::true_type  {};
+
+    //A half or bfloat16 with another one of them or with any number, both compared as the floats (or numbers) they widen to
+    template <typename T1, typename T2>
+    struct is_reduced_number_pair : std::bool_constant<(is_reduced_float<T1>::value && (is_reduced_float<T2>::value || std::is_arithmetic_v<T2>)) ||
+                                                       (is_reduced_float<T2>::value && std::is_arithmetic_v<T1>)> {};
+
+    template <typename T>
+    inline auto widenReduced(const T& value){
+
+        if constexpr(is_reduced_float<T>::value) return value.toFloat();
+        else                                     return value;
+
+    }
+
+    //Contiguous runs of halves or bfloat16s, and QuantizedViews, i.e. everything reducedValue can read without being a plain number
+    template <typename Range, typename = void>
+    struct is_reduced_range : is_quantized_view<Range> {};
+
+    template <typename Range>
+    struct is_reduced_range<Range, std::enable_if_t<is_contiguous<Range>::value>> : is_reduced_float<contiguous_element_t<Range>> {};
+
+    //A reduced run against another one or against a flat run of numbers
+    template <typename Range1, typename Range2>
+    struct is_reduced_range_pair : std::bool_constant<(is_reduced_range<Range1>::value && (is_reduced_range<Range2>::value || is_contiguous_arithmetic<Range2>::value)) ||
+                                                      (is_reduced_range<Range2>::value && is_contiguous_arithmetic<Range1>::value)> {};
+
+    //What one element of either side of a reduced pair takes up in memory, the raw integers for a QuantizedView
+    template <typename Range>
+    constexpr std::size_t storedElementSize(){
+
+        if constexpr(is_quantized_view<Range>::value) return sizeof(*std::declval<const Range&>().values());
+        else                                          return sizeof(contiguous_element_t<Range>);
+
+    }
+
+    template <typename Range>
+    constexpr auto reducedSource(const Range& range){
+
+        if constexpr(is_quantized_view<Range>::value) return range;
+        else                                          return adlData(range);
+
+    }
+
+    //Elements [first, end) of two runs at least one of which is reduced. The reduced one always goes first, since that's the side the kernels widen.
+    template <typename Range1, typename Range2, typename Tolerance>
+    inline bool compareReducedRange(const Range1& range1, const Range2& range2, std::size_t first, std::size_t end, const Tolerance& tolerance){
+
+        if constexpr(is_reduced_range<Range1>::value) return compareReducedRun(reducedSource(range1), reducedSource(range2), first, end, tolerance);
+        else                                          return compareReducedRun(reducedSource(range2), reducedSource(range1), first, end, tolerance);
+
+    }
+
+    template <typename Contiguous1, typename Contiguous2, typename = void>
+    struct is_bitwise_comparable_range : std::false_type {};
+
+    template <typename Contiguous1, typename Contiguous2>
+    struct is_bitwise_comparable_range<Contiguous1, Contiguous2, std::enable_if_t<is_contiguous<Contiguous1>::value && is_contiguous<Contiguous2>::value>>
+        : is_bitwise_comparable<contiguous_element_t<Contiguous1>, contiguous_element_t<Contiguous2>> {};
+
+    //Two std::arrays of the same length, small enough to be worth unrolling element by element, which also lets them fold away completely at compile time
+    template <typename Array1, typename Array2>
+    struct is_unrollable_array_pair : std::false_type {};
+
+    template <typename T, typename V, std::size_t N>
+    struct is_unrollable_array_pair<std::array<T, N>, std::array<V, N>> : std::bool_constant<(N <= 16)> {};
+
+    template <typename>   struct is_strided_view                 : std::false_type {};
+    template <typename T> struct is_strided_view<StridedView<T>> : std::true_type  {};
+
+    template <typename>   struct is_matrix_view                : std::false_type {};
+    template <typename T> struct is_matrix_view<MatrixView<T>> : std::true_type  {};
+
+    template <typename Range>
+    using range_element_t = std::remove_cv_t<std::remove_reference_t<decltype(*adlBegin(std::declval<const Range&>()))>>;
+
+    //How many numbers of which one type a fixed size element is made of, when it's laid out as nothing but those numbers:
+    //a float is one float, a std::array<float, 3> three and a std::array<std::array<double, 4>, 4> (or a double[4][4]) sixteen doubles
+    template <typename T, typename = void>
+    struct flat_arithmetic{
+
+        static constexpr bool        value  = false;
+        static constexpr std::size_t count  = 0;
+        static constexpr std::size_t extent = 0;
+
+    };
+
+    template <typename T>
+    struct flat_arithmetic<T, std::enable_if_t<std::is_arithmetic_v<T>>>{
+
+        static constexpr bool        value  = true;
+        static constexpr std::size_t count  = 1;
+        static constexpr std::size_t extent = 0;
+        using scalar = T;
+
+    };
+
+    template <typename T, std::size_t N>
+    struct flat_arithmetic<std::array<T, N>, std::enable_if_t<flat_arithmetic<T>::value && sizeof(std::array<T, N>) == N * sizeof(T)>>{
+
+        static constexpr bool        value  = true;
+        static constexpr std::size_t count  = N * flat_arithmetic<T>::count;
+        static constexpr std::size_t extent = N;
+        using scalar  = typename flat_arithmetic<T>::scalar;
+        using element = T;
+
+    };
+
+    template <typename T, std::size_t N>
+    struct flat_arithmetic<T[N], std::enable_if_t<flat_arithmetic<T>::value>>{
+
+        static constexpr bool        value  = true;
+        static constexpr std::size_t count  = N * flat_arithmetic<T>::count;
+        static constexpr std::size_t extent = N;
+        using scalar  = typename flat_arithmetic<T>::scalar;
+        using element = T;
+
+    };
+
+    //Whether two flat arithmetic types nest the same way, with the same extent at every level, down to a number on both sides. The same count of
+    //numbers isn't enough: a std::array<std::array<double, 2>, 2> doesn't compare to a std::array<double, 4>, nor a std::array<float, 1> to a float
+    template <typename T, typename V, typename = void>
+    struct has_same_flat_shape : std::false_type {};
+
+    template <typename T, typename V>
+    struct has_same_flat_shape<T, V, std::enable_if_t<std::is_arithmetic_v<T> && std::is_arithmetic_v<V>>> : std::true_type {};
+
+    template <typename T, typename V>
+    struct has_same_flat_shape<T, V, std::enable_if_t<flat_arithmetic<T>::value && flat_arithmetic<V>::value && flat_arithmetic<T>::extent != 0 &&
+                                                      flat_arithmetic<T>::extent == flat_arithmetic<V>::extent>>
+        : has_same_flat_shape<typename flat_arithmetic<T>::element, typename flat_arithmetic<V>::element> {};
+
+    //Two contiguous runs of fixed size arithmetic elements of the same shape (i.e. a std::vector<std::array<float, 3>> point cloud and a
+    //std::vector<std::array<double, 3>> one), which are really just two longer flat runs of numbers
+    template <typename Contiguous1, typename Contiguous2, typename = void>
+    struct is_flattenable_range_pair : std::false_type {};
+
+    template <typename Contiguous1, typename Contiguous2>
+    struct is_flattenable_range_pair<Contiguous1, Contiguous2, std::enable_if_t<is_contiguous<Contiguous1>::value && is_contiguous<Contiguous2>::value>>
+        : std::bool_constant<!std::is_arithmetic_v<contiguous_element_t<Contiguous1>> &&
+                             has_same_flat_shape<contiguous_element_t<Contiguous1>, contiguous_element_t<Contiguous2>>::value> {};
+
+    //Anything that's a pointer and a step away from its numbers: contiguous arithmetic ranges (a step of 1) and StridedViews of numbers
+    template <typename T, typename = void>
+    struct is_strided_arithmetic : is_contiguous_arithmetic<T> {};
+
+    template <typename T>
+    struct is_strided_arithmetic<StridedView<T>> : std::is_arithmetic<std::remove_cv_t<T>> {};
+
+    template <typename Strided1, typename Strided2>
+    struct is_strided_arithmetic_pair : std::bool_constant<(is_strided_view<Strided1>::value || is_strided_view<Strided2>::value) &&
+                                                           is_strided_arithmetic<Strided1>::value && is_strided_arithmetic<Strided2>::value> {};
+
+    template <typename Strided>
+    constexpr auto stridedStart(const Strided& strided){
+
+        if constexpr(is_strided_view<Strided>::value) return strided.base();
+        else                                          return adlData(strided);
+
+    }
+
+    template <typename Strided>
+    constexpr std::ptrdiff_t stridedStep(const Strided& strided){
+
+        if constexpr(is_strided_view<Strided>::value) return strided.stride();
+        else                                          return ((void) strided, 1);
+
+    }
+
+} //namespace isEqualDetail
+
+namespace isEqualDetail{
+
+    //A code unit's value, unsigned, so the same bits mean the same thing whichever type they came in
+    template <typename Unit>
+    constexpr std::uint32_t codeUnitValue(Unit unit){
+
+        if constexpr(std::is_same_v<Unit, std::byte>) return std::to_integer<std::uint32_t>(unit);
+        else                                          return static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<Unit>>(unit));
+
+    }
+
+    constexpr std::uint32_t asciiFold(std::uint32_t value){
+
+        return (value >= 'A' && value <= 'Z') ? (value | 0x20) : value;
+
+    }
+
+    /*
+     * Everything that's a string as far as isEqual is concerned: every std::basic_string and std::basic_string_view, std::vectors of
+     * char or std::byte, NUL terminated char pointers, and char arrays. A char array is all N of its chars, bar a NUL in the very last one,
+     * so a string literal still matches the std::string it spells and two fixed size buffers get every byte compared, NULs and all.
+     * Two of them are compared exactly, code unit by code unit, never with a tolerance. Anything else (a std::vector<unsigned char>
+     * of pixel values, say) still counts as numbers.
+     */
+    template <typename T, typename = void>
+    struct string_traits{
+
+        static constexpr bool value = false;
+
+    };
+
+    template <typename Unit, typename Traits, typename Allocator>
+    struct string_traits<std::basic_string<Unit, Traits, Allocator>>{
+
+        static constexpr bool value           = true;
+        static constexpr bool caseInsensitive = false;
+
+        static constexpr const Unit* data  (const std::basic_string<Unit, Traits, Allocator>& string){ return string.data(); }
+        static constexpr std::size_t length(const std::basic_string<Unit, Traits, Allocator>& string){ return string.size(); }
+        static constexpr bool        isNull(const std::basic_string<Unit, Traits, Allocator>&)       { return false;         }
+
+    };
+
+    template <typename Unit, typename Traits>
+    struct string_traits<std::basic_string_view<Unit, Traits>>{
+
+        static constexpr bool value           = true;
+        static constexpr bool caseInsensitive = false;
+
+        static constexpr const Unit* data  (const std::basic_string_view<Unit, Traits>& string){ return string.data(); }
+        static constexpr std::size_t length(const std::basic_string_view<Unit, Traits>& string){ return string.size(); }
+        static constexpr bool        isNull(const std::basic_string_view<Unit, Traits>&)       { return false;         }
+
+    };
+
+    template <typename Unit, typename Allocator>
+    struct string_traits<std::vector<Unit, Allocator>, std::enable_if_t<std::is_same_v<Unit, char> || std::is_same_v<Unit, std::byte>>>{
+
+        static constexpr bool value           = true;
+        static constexpr bool caseInsensitive = false;
+
+        static constexpr const Unit* data  (const std::vector<Unit, Allocator>& string){ return string.data(); }
+        static constexpr std::size_t length(const std::vector<Unit, Allocator>& string){ return string.size(); }
+        static constexpr bool        isNull(const std::vector<Unit, Allocator>&)       { return false;         }
+
+    };
+
+    //A null pointer only ever equals another null pointer, never an empty string
+    template <typename Char>
+    struct string_traits<Char*, std::enable_if_t<std::is_same_v<std::remove_const_t<Char>, char>>>{
+
+        static constexpr bool value           = true;
+        static constexpr bool caseInsensitive = false;
+
+        static constexpr const char* data  (const char* string){ return string;                                           }
+        static constexpr std::size_t length(const char* string){ return string ? std::char_traits<char>::length(string) : 0; }
+        static constexpr bool        isNull(const char* string){ return string == nullptr;                                 }
+
+    };
+
+    template <std::size_t N>
+    struct string_traits<char[N]>{
+
+        static constexpr bool value           = true;
+        static constexpr bool caseInsensitive = false;
+
+        static constexpr const char* data(const char (&string)[N]){ return string; }
+
+        static constexpr std::size_t length(const char (&string)[N]){
+
+            return string[N - 1] == '\0' ? N - 1 : N;
+
+        }
+
+        static constexpr bool isNull(const char (&)[N]){ return false; }
+
+    };
+
+    template <typename String>
+    using string_unit_t = std::remove_cv_t<std::remove_pointer_t<decltype(string_traits<String>::data(std::declval<const String&>()))>>;
+
+} //namespace isEqualDetail
+
+/*
+ * Any string (see string_traits) read with ASCII letters folded to lower case. Compared against any other string, or another one of
+ * these, it matches whenever the two only differ in the case of A-Z; every other code unit still has to match exactly. Like ArrayView
+ * it only points at the characters, so the string it was made from has to outlive it.
+ *
+ *     isEqual(asciiCaseInsensitive(headerName), "Content-Length")
+ */
+template <typename Unit>
+class AsciiCaseInsensitiveView{
+
+public:
+
+    constexpr AsciiCaseInsensitiveView(const Unit* startIn, std::size_t countIn)
+        : start(startIn),
+          count(countIn){
+
+        /* NOP */
+
+    }
+
+    constexpr const Unit* units()  const{ return start; }
+    constexpr std::size_t length() const{ return count; }
+
+private:
+
+    const Unit* start;
+    std::size_t count;
+
+};
+
+template <typename String>
+constexpr auto asciiCaseInsensitive(const String& string){
+
+    static_assert(isEqualDetail::string_traits<String>::value, "asciiCaseInsensitive needs a string, string_view, char vector, char pointer or char array");
+
+    return AsciiCaseInsensitiveView<isEqualDetail::string_unit_t<String>>(isEqualDetail::string_traits<String>::data(string),
+                                                                         isEqualDetail::string_traits<String>::length(string));
+
+}
+
+namespace isEqualDetail{
+
+    template <typename Unit>
+    struct string_traits<AsciiCaseInsensitiveView<Unit>>{
+
+        static constexpr bool value           = true;
+        static constexpr bool caseInsensitive = true;
+
+        static constexpr const Unit* data  (const AsciiCaseInsensitiveView<Unit>& string){ return string.units();  }
+        static constexpr std::size_t length(const AsciiCaseInsensitiveView<Unit>& string){ return string.length(); }
+        static constexpr bool        isNull(const AsciiCaseInsensitiveView<Unit>&)       { return false;           }
+
+    };
+
+    template <typename String1, typename String2>
+    struct is_string_pair : std::bool_constant<string_traits<String1>::value && string_traits<String2>::value> {};
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+    //Letters are the bytes strictly between '@' and '[' (signed compares, so everything from 0x80 up never counts), and folding one just sets bit 5
+    inline __m128i foldAsciiSSE2(__m128i units){
+
+        __m128i isUpper = _mm_and_si128(_mm_cmpgt_epi8(units, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), units));
+
+        return _mm_or_si128(units, _mm_and_si128(isUpper, _mm_set1_epi8(0x20)));
+
+    }
+
+    inline bool compareAsciiCaseInsensitiveSSE2(const unsigned char* units1, const unsigned char* units2, std::size_t count, std::size_t& index){
+
+        for(; index + 16 <= count; index += 16){
+
+            __m128i folded1 = foldAsciiSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(units1 + index)));
+            __m128i folded2 = foldAsciiSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(units2 + index)));
+
+            if(_mm_movemask_epi8(_mm_cmpeq_epi8(folded1, folded2)) != 0xFFFF){
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    __attribute__((target("avx2")))
+    inline __m256i foldAsciiAVX2(__m256i units){
+
+        __m256i isUpper = _mm256_and_si256(_mm256_cmpgt_epi8(units, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), units));
+
+        return _mm256_or_si256(units, _mm256_and_si256(isUpper, _mm256_set1_epi8(0x20)));
+
+    }
+
+    __attribute__((target("avx2")))
+    inline bool compareAsciiCaseInsensitiveAVX2(const unsigned char* units1, const unsigned char* units2, std::size_t count, std::size_t& index){
+
+        for(; index + 32 <= count; index += 32){
+
+            __m256i folded1 = foldAsciiAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(units1 + index)));
+            __m256i folded2 = foldAsciiAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(units2 + index)));
+
+            if(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(folded1, folded2))) != 0xFFFFFFFFu){
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+#endif //defined(__GNUC__) && defined(__x86_64__)
+
+    //Two runs of code units, the same length, equal once A-Z are folded. Single byte units get folded 16 or 32 at a time.
+    template <typename Unit1, typename Unit2>
+    constexpr bool compareAsciiCaseInsensitive(const Unit1* units1, const Unit2* units2, std::size_t count){
+
+        std::size_t index = 0;
+
+        #if defined(__GNUC__) && defined(__x86_64__)
+
+        if constexpr(sizeof(Unit1) == 1 && sizeof(Unit2) == 1){
+
+            //Anything shorter than a vector is all tail anyway (and GCC can't tell the loads never happen for a short literal otherwise)
+            if(!isConstantEvaluated() && count >= 16){
+
+                const unsigned char* bytes1 = reinterpret_cast<const unsigned char*>(units1);
+                const unsigned char* bytes2 = reinterpret_cast<const unsigned char*>(units2);
+
+                bool vectorEqual = detectSimdLevel() >= SimdLevel::AVX2 ? compareAsciiCaseInsensitiveAVX2(bytes1, bytes2, count, index)
+                                                                        : compareAsciiCaseInsensitiveSSE2(bytes1, bytes2, count, index);
+
+                if(!vectorEqual){
+
+                    return false;
+
+                }
+
+            }
+
+        }
+
+        #endif //defined(__GNUC__) && defined(__x86_64__)
+
+        for(; index < count; ++index){
+
+            if(asciiFold(codeUnitValue(units1[index])) != asciiFold(codeUnitValue(units2[index]))){
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    //Where two strings of the same length first differ, only ever asked once they're known to, for a MismatchReport
+    template <typename Unit1, typename Unit2>
+    std::size_t firstStringDifference(const Unit1* units1, const Unit2* units2, std::size_t count, bool caseInsensitive){
+
+        std::size_t index = 0;
+
+        while(index < count && (caseInsensitive ? asciiFold(codeUnitValue(units1[index])) == asciiFold(codeUnitValue(units2[index]))
+                                                : codeUnitValue(units1[index]) == codeUnitValue(units2[index]))){
+
+            ++index;
+
+        }
+
+        return index;
+
+    }
+
+    template <typename Unit>
+    std::string describeCodeUnit(Unit unit){
+
+        if constexpr(std::is_same_v<Unit, char>) return std::string("'") + unit + "'";
+        else                                     return std::to_string(codeUnitValue(unit));
+
+    }
+
+    //Exactly equal (or equal but for the case of A-Z, when either side asked for that), byte runs of the same unit size through memcmp
+    template <typename String1, typename String2>
+    constexpr bool compareStrings(const String1& string1, const String2& string2){
+
+        using Traits1 = string_traits<String1>;
+        using Traits2 = string_traits<String2>;
+
+        if(Traits1::isNull(string1) || Traits2::isNull(string2)){
+
+            return Traits1::isNull(string1) && Traits2::isNull(string2);
+
+        }
+
+        std::size_t length = Traits1::length(string1);
+
+        if(length != Traits2::length(string2)){
+
+            return false;
+
+        }
+
+        const auto* units1 = Traits1::data(string1);
+        const auto* units2 = Traits2::data(string2);
+
+        if constexpr(Traits1::caseInsensitive || Traits2::caseInsensitive){
+
+            return compareAsciiCaseInsensitive(units1, units2, length);
+
+        }
+        else{
+
+            if constexpr(sizeof(*units1) == sizeof(*units2)){
+
+                if(!isConstantEvaluated()){
+
+                    return length == 0 || std::memcmp(units1, units2, length * sizeof(*units1)) == 0;
+
+                }
+
+            }
+
+            for(std::size_t index = 0; index < length; ++index){
+
+                if(codeUnitValue(units1[index]) != codeUnitValue(units2[index])){
+
+                    return false;
+
+                }
+
+            }
+
+            return true;
+
+        }
+
+    }
+
+} //namespace isEqualDetail
+
+//One step on the way from the top level objects down to where they stopped being equal. Allocator aware, so a std::pmr::vector of them
+//(like the one in MismatchReport) hands its memory resource down to the strings as well.
+struct MismatchFrame{
+
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    enum class Kind{ Element, PairMember, TupleElement, Member };
+
+    Kind             kind;
+    std::pmr::string container;   //only used by Element frames that end up first in the path, i.e. "map" or "vector"
+    std::pmr::string text;        //"[36]", ".second", "tuple<2>" or "dVector"
+
+    MismatchFrame(Kind kindIn, std::string_view containerIn, std::string_view textIn, const allocator_type& allocator = allocator_type())
+        : kind(kindIn),
+          container(containerIn, allocator),
+          text(textIn, allocator){
+
+        /* NOP */
+
+    }
+
+    MismatchFrame(const MismatchFrame& other, const allocator_type& allocator)
+        : kind(other.kind),
+          container(other.container, allocator),
+          text(other.text, allocator){
+
+        /* NOP */
+
+    }
+
+    MismatchFrame(MismatchFrame&& other, const allocator_type& allocator)
+        : kind(other.kind),
+          container(std::move(other.container), allocator),
+          text(std::move(other.text), allocator){
+
+        /* NOP */
+
+    }
+
+    MismatchFrame(const MismatchFrame&)            = default;
+    MismatchFrame(MismatchFrame&&)                 = default;
+    MismatchFrame& operator=(const MismatchFrame&) = default;
+    MismatchFrame& operator=(MismatchFrame&&)      = default;
+
+};
+
+//Everything known about a single mismatch: where it is, both values, and how far apart they were whenever that's a number
+struct Mismatch{
+
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    std::pmr::vector<MismatchFrame> frames;         //innermost first, since they get added while the recursion unwinds
+    std::pmr::string                value1;
+    std::pmr::string                value2;
+    double                          delta    = 0.0;
+    bool                            hasDelta = false;
+
+    Mismatch() = default;
+
+    explicit Mismatch(const allocator_type& allocator)
+        : frames(allocator),
+          value1(allocator),
+          value2(allocator){
+
+        /* NOP */
+
+    }
+
+    Mismatch(const Mismatch& other, const allocator_type& allocator)
+        : frames(other.frames, allocator),
+          value1(other.value1, allocator),
+          value2(other.value2, allocator),
+          delta(other.delta),
+          hasDelta(other.hasDelta){
+
+        /* NOP */
+
+    }
+
+    Mismatch(Mismatch&& other, const allocator_type& allocator)
+        : frames(std::move(other.frames), allocator),
+          value1(std::move(other.value1), allocator),
+          value2(std::move(other.value2), allocator),
+          delta(other.delta),
+          hasDelta(other.hasDelta){
+
+        /* NOP */
+
+    }
+
+    Mismatch(const Mismatch&)            = default;
+    Mismatch(Mismatch&&)                 = default;
+    Mismatch& operator=(const Mismatch&) = default;
+    Mismatch& operator=(Mismatch&&)      = default;
+
+    //Renders the frames outermost first, i.e. map[36].second -> tuple<2> -> dVector[2]
+    std::string path() const{
+
+        std::string renderedPath;
+
+        for(auto frameIter = frames.rbegin(); frameIter != frames.rend(); ++frameIter){
+
+            bool isFirst = renderedPath.empty();
+
+            switch(frameIter->kind){
+                case MismatchFrame::Kind::Element:      renderedPath.append(isFirst ? std::string_view(frameIter->container) : std::string_view()).append(frameIter->text); break;
+                case MismatchFrame::Kind::PairMember:   renderedPath.append(isFirst ? std::string_view("pair") : std::string_view()).append(frameIter->text);            break;
+                case MismatchFrame::Kind::TupleElement:
+                case MismatchFrame::Kind::Member:       renderedPath.append(isFirst ? std::string_view() : std::string_view(" -> ")).append(frameIter->text);           break;
+            }
+
+        }
+
+        return renderedPath.empty() ? std::string("<top level>") : renderedPath;
+
+    }
+
+};
+
+//Which of isEqualWith's branches a comparison went down, only ever looked at by instrumented reporters (see isEqualInstrumentation.h).
+//The iterable branch is split by how it ended up scanning, so an element by element loop shows up apart from the kernels.
+enum class ComparisonBranch{
+
+    Lookup,             //a hashed container against anything keyed, walked one side and looked up in the other
+    Map,                //two ordered maps or sets, walked side by side
+    String,             //two strings (or string_views, char vectors, char pointers...), compared exactly
+    UnrolledArray,      //two small std::arrays, unrolled
+    ContiguousRange,    //two flat runs of numbers (or bitwise comparable elements) handed to memcmp or the kernels
+    StridedRange,       //strided runs of numbers gathered into the kernels
+    ReducedRange,       //runs of halves, bfloat16s or quantized integers widened in registers by the kernels
+    Iterable,           //any other two iterables, walked element by element
+    SinglePass,         //two single pass sequences, walked in lockstep
+    Matrix,             //two MatrixViews
+    Nullptr,
+    Fundamental,
+    Tuple,              //tuples and pairs
+    Members,            //types with an isEqualMembers
+    EqualityOperator,   //same types with an operator==
+    Incompatible,       //the always false fallback
+    Count
+
+};
+
+namespace isEqualDetail{
+
+    template <typename T, typename = void>
+    struct is_streamable : std::false_type {};
+
+    template <typename T>
+    struct is_streamable<T, std::void_t<decltype(std::declval<std::ostream&>() << std::declval<const T&>())>> : std::true_type {};
+
+    //Only ever called once something didn't match, so the stringstream never shows up on the equal path
+    template <typename T>
+    std::string describeValue(const T& value){
+
+        if constexpr(std::is_same_v<T, std::nullptr_t>){
+
+            return "nullptr";
+
+        }
+        else if constexpr(is_streamable<T>::value){
+
+            //Enough digits to round trip floating point values, since the ones that differ tend to differ in the last few
+            std::ostringstream description;
+            description << std::boolalpha;
+
+            if constexpr(std::is_floating_point_v<T>){
+
+                description << std::setprecision(std::numeric_limits<T>::max_digits10);
+
+            }
+
+            description << value;
+            return description.str();
+
+        }
+        else if constexpr(is_iterable<T>::value){
+
+            return "<" + std::to_string(adlSize(value)) + " elements>";
+
+        }
+        else{
+
+            (void) value;
+            return "<not printable>";
+
+        }
+
+    }
+
+    //Numbers describeValue would print as numbers, chars (which it prints as characters) and bools are left out
+    template <typename T>
+    struct is_chars_formattable : std::bool_constant<std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+                                                     !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char> &&
+                                                     !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>> {};
+
+    //Same text as describeValue, but numbers go through std::to_chars on the stack, so describing one never allocates anything
+    //except what the (possibly pmr) destination string needs
+    template <typename String, typename T>
+    void describeValueInto(String& description, const T& value){
+
+        if constexpr(is_chars_formattable<T>::value){
+
+            char buffer[64];
+            std::to_chars_result written;
+
+            if constexpr(std::is_floating_point_v<T>){
+
+                written = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, std::numeric_limits<T>::max_digits10);
+
+            }
+            else{
+
+                written = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+            }
+
+            description.assign(buffer, written.ptr);
+
+        }
+        else if constexpr(std::is_same_v<T, bool>){
+
+            description.assign(value ? "true" : "false");
+
+        }
+        else{
+
+            description.assign(describeValue(value));
+
+        }
+
+    }
+
+    template <typename>                       struct is_std_vector                          : std::false_type {};
+    template <typename T, typename Allocator> struct is_std_vector<std::vector<T, Allocator>> : std::true_type  {};
+
+    template <typename>                       struct is_std_list                          : std::false_type {};
+    template <typename T, typename Allocator> struct is_std_list<std::list<T, Allocator>> : std::true_type  {};
+
+    //Only used to make report paths read a little nicer, anything not listed here just shows up as an iterable
+    template <typename T>
+    std::string containerName(){
+
+        if constexpr(is_map<T>::value)                 return "map";
+        else if constexpr(is_set<T>::value)            return "set";
+        else if constexpr(is_unordered_map<T>::value)  return "unordered_map";
+        else if constexpr(is_unordered_set<T>::value)  return "unordered_set";
+        else if constexpr(std::is_array_v<T>)          return "array";
+        else if constexpr(is_std_vector<T>::value)     return "vector";
+        else if constexpr(is_std_list<T>::value)       return "list";
+        else if constexpr(is_strided_view<T>::value)   return "strided";
+        else                                           return "iterable";
+
+    }
+
+    //Disabled reporters make this a constant, so the loops below stop at the first mismatch exactly like they always have
+    template <typename Reporter>
+    constexpr bool keepScanning(bool isEqualSoFar, const Reporter& reporter){
+
+        if constexpr(Reporter::enabled){
+
+            return isEqualSoFar || reporter.wantsMore();
+
+        }
+        else{
+
+            (void) reporter;
+            return isEqualSoFar;
+
+        }
+
+    }
+
+    //Reporters that say static constexpr bool instrumented = true get told about every branch taken and every call made,
+    //for all the others (NoMismatchReport and MismatchReport included) the hooks below compile away to nothing
+    template <typename Reporter, typename = void>
+    struct is_instrumented : std::false_type {};
+
+    template <typename Reporter>
+    struct is_instrumented<Reporter, std::enable_if_t<Reporter::instrumented>> : std::true_type {};
+
+    //Elements and bytes are what got handed to a scan, leaves count as one element each and fast paths count their whole run
+    template <typename Reporter>
+    constexpr void countBranch(Reporter& reporter, ComparisonBranch branch, std::size_t elements = 0, std::size_t bytes = 0){
+
+        if constexpr(is_instrumented<Reporter>::value){
+
+            reporter.countBranch(branch, elements, bytes);
+
+        }
+        else{
+
+            (void) reporter;
+            (void) branch;
+            (void) elements;
+            (void) bytes;
+
+        }
+
+    }
+
+    template <typename Reporter>
+    constexpr void enterComparison(Reporter& reporter){
+
+        if constexpr(is_instrumented<Reporter>::value){
+
+            reporter.enterComparison();
+
+        }
+        else{
+
+            (void) reporter;
+
+        }
+
+    }
+
+    template <typename Reporter>
+    constexpr void leaveComparison(Reporter& reporter, bool result){
+
+        if constexpr(is_instrumented<Reporter>::value){
+
+            reporter.leaveComparison(result);
+
+        }
+        else{
+
+            (void) reporter;
+            (void) result;
+
+        }
+
+    }
+
+} //namespace isEqualDetail
+
+//The default policy, every hook compiles away and isEqualWith(..., NoMismatchReport&) is exactly the plain boolean isEqual
+struct NoMismatchReport{
+
+    static constexpr bool enabled = false;
+
+};
+
+/*
+ * Records the first mismatch (or the first maxMismatches of them) as a structured path, both values and their delta.
+ * Nothing gets recorded, formatted or allocated until something actually fails to match, so on equal inputs it costs
+ * next to nothing. Once the requested number of mismatches has been found the comparison stops just like isEqual would.
+ *
+ * Everything recorded (the mismatches, their paths and both values) lives in the given memory resource, so a report on a
+ * std::pmr::monotonic_buffer_resource over a stack buffer never touches the global heap. Numbers get formatted on the stack,
+ * only values described through their operator<< and descriptions too long for std::string's small buffer pass through it.
+ */
+class MismatchReport{
+
+public:
+
+    static constexpr bool enabled = true;
+
+    explicit MismatchReport(std::size_t maxMismatchesIn = 1, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : maxMismatches(std::max<std::size_t>(1, maxMismatchesIn)),
+          found(resource){
+
+        /* NOP */
+
+    }
+
+    const std::pmr::vector<Mismatch>& mismatches() const{ return found;                          }
+    std::size_t                       count()      const{ return found.size();                   }
+    bool                              wantsMore()  const{ return found.size() < maxMismatches;   }
+
+    //A leaf mismatch between two values, which get a delta whenever they're both numbers
+    template <typename Value1, typename Value2>
+    void recordValues(const Value1& value1, const Value2& value2){
+
+        Mismatch& mismatch = found.emplace_back();
+        isEqualDetail::describeValueInto(mismatch.value1, value1);
+        isEqualDetail::describeValueInto(mismatch.value2, value2);
+
+        if constexpr(std::is_arithmetic_v<Value1> && std::is_arithmetic_v<Value2>){
+
+            mismatch.delta    = fabs(static_cast<double>(value1) - static_cast<double>(value2));
+            mismatch.hasDelta = true;
+
+        }
+
+    }
+
+    //A leaf mismatch that isn't about two values, like differing sizes or a missing key
+    void recordDescription(std::string_view description1, std::string_view description2){
+
+        Mismatch& mismatch = found.emplace_back();
+        mismatch.value1.assign(description1);
+        mismatch.value2.assign(description2);
+
+    }
+
+    //Tags every mismatch recorded since the given count with one more step of its path
+    void addFrame(std::size_t since, MismatchFrame::Kind kind, std::string_view container, std::string_view text){
+
+        for(std::size_t index = since; index < found.size(); ++index){
+
+            found[index].frames.emplace_back(kind, container, text);
+
+        }
+
+    }
+
+    //One line per mismatch, i.e. map[36].second -> tuple<2> -> dVector[2]: 3 vs 4 (delta 1)
+    std::string toString() const{
+
+        std::ostringstream description;
+
+        for(const Mismatch& mismatch : found){
+
+            description << mismatch.path() << ": " << mismatch.value1 << " vs " << mismatch.value2;
+
+            if(mismatch.hasDelta){
+
+                description << " (delta " << mismatch.delta << ")";
+
+            }
+
+            description << std::endl;
+
+        }
+
+        return description.str();
+
+    }
+
+private:
+
+    std::size_t                maxMismatches;
+    std::pmr::vector<Mismatch> found;
+
+};
+
+//Declared up front for the helpers below, which recurse back into it
+template <typename Comparable1, typename Comparable2, typename Tolerance, typename Reporter>
+static constexpr std::enable_if_t<!std::is_arithmetic_v<Tolerance>, bool>
+isEqualWith(const Comparable1& comparable1, const Comparable2& comparable2, const Tolerance& tolerance, Reporter& reporter);
+
+namespace isEqualDetail{
+
+    //Types can opt into member by member comparisons (and reports) with a member function along the lines of:
+    //    template <typename Tolerance, typename Reporter> bool isEqualMembers(const T& other, const Tolerance& tolerance, Reporter& reporter) const
+    template <typename T, typename Tolerance, typename Reporter, typename = void>
+    struct has_member_comparison : std::false_type {};
+
+    template <typename T, typename Tolerance, typename Reporter>
+    struct has_member_comparison<T, Tolerance, Reporter, std::void_t<decltype(std::declval<const T&>().isEqualMembers(std::declval<const T&>(),
+                                                                                                                      std::declval<const Tolerance&>(),
+                                                                                                                      std::declval<Reporter&>()))>>
+        : std::true_type {};
+
+    //The key of a map's or a set's entry
+    template <typename Container, typename Iterator>
+    const auto& entryKey(const Iterator& iter){
+
+        if constexpr(is_unordered_map<Container>::value || is_map<Container>::value) return iter->first;
+        else                                                                         return *iter;
+
+    }
+
+    //Keys only ever match exactly (integers by value, never rounded through floating point), whatever the tolerance is for the values
+    template <typename Key1, typename Key2>
+    bool isExactKey(const Key1& key1, const Key2& key2){
+
+        NoMismatchReport noReport{};
+
+        return isEqualWith(key1, key2, ExactTolerance{}, noReport);
+
+    }
+
+    //find hashes and compares with the looked up side's own key_type, so a key of another type gets converted (and narrowed) on the way in:
+    //a long 2^32 + 1 finds an int 1 and a double 1.5 finds an int 1 too. Same key types can take find at its word, everything else gets the
+    //key it came back with checked against the one we looked up, exactly.
+    //No exact match can hide behind a rejected one, a key that has one converts to that very key.
+    template <typename LookedUp, typename Key>
+    auto findExactKey(const LookedUp& lookedUp, const Key& key){
+
+        auto lookedUpIter = lookedUp.find(key);
+
+        if constexpr(!std::is_same_v<std::decay_t<Key>, typename LookedUp::key_type>){
+
+            if(lookedUpIter != lookedUp.end() && !isExactKey(key, entryKey<LookedUp>(lookedUpIter))){
+
+                return lookedUp.end();
+
+            }
+
+        }
+
+        return lookedUpIter;
+
+    }
+
+    //findExactKey for the multimaps and multisets, every entry under the key (or none)
+    template <typename LookedUp, typename Key>
+    auto equalRangeExactKey(const LookedUp& lookedUp, const Key& key){
+
+        auto lookedUpRange = lookedUp.equal_range(key);
+
+        if constexpr(!std::is_same_v<std::decay_t<Key>, typename LookedUp::key_type>){
+
+            if(lookedUpRange.first != lookedUpRange.second && !isExactKey(key, entryKey<LookedUp>(lookedUpRange.first))){
+
+                return std::make_pair(lookedUp.end(), lookedUp.end());
+
+            }
+
+        }
+
+        return lookedUpRange;
+
+    }
+
+    //Whether the entries two multimaps (or multisets) hold under the same key are equal, in whatever order each one keeps them: as many on
+    //both sides, and for maps every value paired off with an equal one the way std::is_permutation pairs them (the same test the standard
+    //containers' own operator== runs). That takes the tolerance to be an equivalence among the values under one key, which it is
+    //exactly for ExactTolerance and for values further apart from each other than the tolerance.
+    template <typename Walked, typename WalkedRange, typename LookedUpRange, typename Tolerance, typename Swapped>
+    bool isEqualKeyGroup(const WalkedRange& walkedRange, const LookedUpRange& lookedUpRange, const Tolerance& tolerance, Swapped){
+
+        if(std::distance(walkedRange.first, walkedRange.second) != std::distance(lookedUpRange.first, lookedUpRange.second)){
+
+            return false;
+
+        }
+
+        if constexpr(is_unordered_map<Walked>::value || is_map<Walked>::value){
+
+            //Called with both entries from one side too, while std::is_permutation counts how often a value repeats
+            auto isEqualEntryValue = [&tolerance](const auto& entry1, const auto& entry2){
+
+                NoMismatchReport noReport{};
+
+                if constexpr(Swapped::value) return isEqualWith(entry2.second, entry1.second, tolerance, noReport);
+                else                         return isEqualWith(entry1.second, entry2.second, tolerance, noReport);
+
+            };
+
+            return std::is_permutation(walkedRange.first, walkedRange.second, lookedUpRange.first, lookedUpRange.second, isEqualEntryValue);
+
+        }
+        else{
+
+            (void) tolerance;
+
+            return true;
+
+        }
+
+    }
+
+    //Every contiguous pair isEqual can compare without recursing: bytes when that's exact, the vectorized kernels otherwise,
+    //and plain scalar loops whenever this ends up running at compile time
+    template <typename Element1, typename Element2, typename Tolerance>
+    constexpr bool compareContiguousRange(const Element1* contiguous1, const Element2* contiguous2, std::size_t count, const Tolerance& tolerance){
+
+        if constexpr(is_bitwise_comparable<std::remove_cv_t<Element1>, std::remove_cv_t<Element2>>::value){
+
+            if(!isConstantEvaluated() && isBitwiseTolerance(tolerance)){
+
+                return compareBitwise(contiguous1, contiguous2, count);
+
+            }
+
+        }
+
+        if constexpr(std::is_arithmetic_v<Element1> && std::is_arithmetic_v<Element2>){
+
+            return isConstantEvaluated() ? compareContiguousScalar(contiguous1, contiguous2, count, tolerance)
+                                         : compareContiguous(contiguous1, contiguous2, count, tolerance);
+
+        }
+        else{
+
+            //Enums and aggregates of integers with a tolerance that lets different integers through (or at compile time), one element at a time
+            for(std::size_t index = 0; index < count; ++index){
+
+                NoMismatchReport noReport{};
+
+                if(!isEqualWith(contiguous1[index], contiguous2[index], tolerance, noReport)){
+
+                    return false;
+
+                }
+
+            }
+
+            return true;
+
+        }
+
+    }
+
+    //Flattenable runs (see is_flattenable_range_pair) as the longer runs of numbers they really are. Equal sizes are up to the caller.
+    template <typename Contiguous1, typename Contiguous2, typename Tolerance>
+    constexpr bool compareFlattened(const Contiguous1& contiguous1, const Contiguous2& contiguous2, const Tolerance& tolerance){
+
+        using Flat1 = flat_arithmetic<contiguous_element_t<Contiguous1>>;
+        using Flat2 = flat_arithmetic<contiguous_element_t<Contiguous2>>;
+
+        //Reinterpreting the arrays as their numbers isn't something a constant expression can do, so those go one array at a time
+        if(isConstantEvaluated()){
+
+            for(std::size_t index = 0; index < static_cast<std::size_t>(adlSize(contiguous1)); ++index){
+
+                NoMismatchReport noReport{};
+
+                if(!isEqualWith(adlData(contiguous1)[index], adlData(contiguous2)[index], tolerance, noReport)){
+
+                    return false;
+
+                }
+
+            }
+
+            return true;
+
+        }
+
+        return compareContiguousRange(reinterpret_cast<const typename Flat1::scalar*>(adlData(contiguous1)),
+                                      reinterpret_cast<const typename Flat2::scalar*>(adlData(contiguous2)),
+                                      static_cast<std::size_t>(adlSize(contiguous1)) * Flat1::count,
+                                      tolerance);
+
+    }
+
+    //Strided numbers get gathered into small contiguous buffers a chunk at a time, so even a column still goes through the vectorized kernels
+    template <typename Element1, typename Element2, typename Tolerance>
+    inline bool compareStridedGathered(const Element1* strided1, std::ptrdiff_t stride1, const Element2* strided2, std::ptrdiff_t stride2,
+                                       std::size_t count, const Tolerance& tolerance){
+
+        constexpr std::size_t bufferElements = 256;
+
+        std::remove_cv_t<Element1> buffer1[bufferElements];
+        std::remove_cv_t<Element2> buffer2[bufferElements];
+
+        for(std::size_t chunkBegin = 0; chunkBegin < count; chunkBegin += bufferElements){
+
+            std::size_t    chunkCount = std::min(bufferElements, count - chunkBegin);
+            std::ptrdiff_t chunkStart = static_cast<std::ptrdiff_t>(chunkBegin);
+            const Element1* chunk1    = buffer1;
+            const Element2* chunk2    = buffer2;
+
+            if(stride1 == 1){
+
+                chunk1 = strided1 + chunkStart;
+
+            }
+            else{
+
+                for(std::size_t index = 0; index < chunkCount; ++index){
+
+                    buffer1[index] = strided1[(chunkStart + static_cast<std::ptrdiff_t>(index)) * stride1];
+
+                }
+
+            }
+
+            if(stride2 == 1){
+
+                chunk2 = strided2 + chunkStart;
+
+            }
+            else{
+
+                for(std::size_t index = 0; index < chunkCount; ++index){
+
+                    buffer2[index] = strided2[(chunkStart + static_cast<std::ptrdiff_t>(index)) * stride2];
+
+                }
+
+            }
+
+            if(!compareContiguousRange(chunk1, chunk2, chunkCount, tolerance)){
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    template <typename Element1, typename Element2, typename Tolerance>
+    constexpr bool compareStridedRange(const Element1* strided1, std::ptrdiff_t stride1, const Element2* strided2, std::ptrdiff_t stride2,
+                                       std::size_t count, const Tolerance& tolerance){
+
+        if(isConstantEvaluated()){
+
+            for(std::size_t index = 0; index < count; ++index){
+
+                std::ptrdiff_t position = static_cast<std::ptrdiff_t>(index);
+
+                if(!isWithinTolerance(strided1[position * stride1], strided2[position * stride2], tolerance)){
+
+                    return false;
+
+                }
+
+            }
+
+            return true;
+
+        }
+
+        if(stride1 == 1 && stride2 == 1){
+
+            return compareContiguousRange(strided1, strided2, count, tolerance);
+
+        }
+
+        return compareStridedGathered(strided1, stride1, strided2, stride2, count, tolerance);
+
+    }
+
+    /*
+     * Two same sized MatrixViews whose contiguous directions differ (row-major against column-major, say), the first one walked along its rows.
+     * Going row by row would pull in a whole cache line of the second one for every single element of it that gets used, so both get cut
+     * into 64 x 64 tiles instead: the second one's tile is read along its own contiguous direction into a buffer, transposed on the way,
+     * and then every row of the first one's tile is compared against a row of that buffer through the usual kernels.
+     */
+    template <typename T1, typename T2, typename Tolerance>
+    inline bool compareMatrixTiles(const MatrixView<T1>& matrix1, const MatrixView<T2>& matrix2, const Tolerance& tolerance){
+
+        constexpr std::size_t tileSize = 64;
+
+        std::remove_cv_t<T2> tile[tileSize * tileSize];
+
+        for(std::size_t rowBegin = 0; rowBegin < matrix1.rows(); rowBegin += tileSize){
+
+            std::size_t rowCount = std::min(tileSize, matrix1.rows() - rowBegin);
+
+            for(std::size_t columnBegin = 0; columnBegin < matrix1.columns(); columnBegin += tileSize){
+
+                std::size_t columnCount = std::min(tileSize, matrix1.columns() - columnBegin);
+
+                //Columns on the outside, since moving down a column is what's (closest to) contiguous on this side
+                for(std::size_t column = 0; column < columnCount; ++column){
+
+                    for(std::size_t row = 0; row < rowCount; ++row){
+
+                        tile[row * tileSize + column] = matrix2(rowBegin + row, columnBegin + column);
+
+                    }
+
+                }
+
+                for(std::size_t row = 0; row < rowCount; ++row){
+
+                    if(!compareStridedRange(&matrix1(rowBegin + row, columnBegin), matrix1.columnStride(), tile + row * tileSize, 1, columnCount, tolerance)){
+
+                        return false;
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    //Two same sized MatrixViews, walked along whichever direction the first one is contiguous in (transposing both when that's its columns)
+    template <typename T1, typename T2, typename Tolerance>
+    constexpr bool compareMatrixViews(MatrixView<T1> matrix1, MatrixView<T2> matrix2, const Tolerance& tolerance){
+
+        auto magnitude = [](std::ptrdiff_t stride){ return stride < 0 ? -stride : stride; };
+
+        if(magnitude(matrix1.columnStride()) > magnitude(matrix1.rowStride())){
+
+            matrix1 = matrix1.transposed();
+            matrix2 = matrix2.transposed();
+
+        }
+
+        if constexpr(std::is_arithmetic_v<std::remove_cv_t<T1>> && std::is_arithmetic_v<std::remove_cv_t<T2>>){
+
+            //Laid out the same way, it's just one strided run per row
+            if(isConstantEvaluated() || magnitude(matrix2.columnStride()) <= magnitude(matrix2.rowStride())){
+
+                for(std::size_t row = 0; row < matrix1.rows(); ++row){
+
+                    if(!compareStridedRange(&matrix1(row, 0), matrix1.columnStride(), &matrix2(row, 0), matrix2.columnStride(), matrix1.columns(), tolerance)){
+
+                        return false;
+
+                    }
+
+                }
+
+                return true;
+
+            }
+
+            return compareMatrixTiles(matrix1, matrix2, tolerance);
+
+        }
+        else{
+
+            for(std::size_t row = 0; row < matrix1.rows(); ++row){
+
+                for(std::size_t column = 0; column < matrix1.columns(); ++column){
+
+                    NoMismatchReport noReport{};
+
+                    if(!isEqualWith(matrix1(row, column), matrix2(row, column), tolerance, noReport)){
+
+                        return false;
+
+                    }
+
+                }
+
+            }
+
+            return true;
+
+        }
+
+    }
+
+    /*
+     * Walks two single pass sequences in lockstep, touching every element exactly once and holding on to none of them, so neither side
+     * needs a size (or even an end that's known yet). Running out on one side before the other is only noticed once it happens, and
+     * makes the two unequal just like differing sizes do. The ends can be sentinels of some other type, as long as != works on them.
+     */
+    template <typename Iterator1, typename Sentinel1, typename Iterator2, typename Sentinel2, typename Tolerance, typename Reporter>
+    constexpr bool compareLockstep(Iterator1 iter1, Sentinel1 end1, Iterator2 iter2, Sentinel2 end2, const Tolerance& tolerance,
+                                   Reporter& reporter, const char* container){
+
+        bool        isEqualRet = true;
+        std::size_t index      = 0;
+
+        for(; keepScanning(isEqualRet, reporter) && (iter1 != end1) && (iter2 != end2); ++iter1, ++iter2){
+
+            std::size_t reportedSoFar = 0;
+
+            if constexpr(Reporter::enabled){
+
+                reportedSoFar = reporter.count();
+
+            }
+
+            bool elementEqual = isEqualWith(*iter1, *iter2, tolerance, reporter);
+
+            if constexpr(Reporter::enabled){
+
+                if(!elementEqual){
+
+                    reporter.addFrame(reportedSoFar, MismatchFrame::Kind::Element, container, "[" + std::to_string(index) + "]");
+
+                }
+
+            }
+            else{
+
+                (void) container;
+
+            }
+
+            isEqualRet = isEqualRet && elementEqual;
+
+            ++index;
+
+        }
+
+        if(!keepScanning(isEqualRet, reporter)){
+
+            return false;
+
+        }
+
+        //Whichever side still has elements left is the longer one
+        bool ended1 = !(iter1 != end1);
+        bool ended2 = !(iter2 != end2);
+
+        if constexpr(Reporter::enabled){
+
+            if(ended1 != ended2){
+
+                reporter.recordDescription(ended1 ? "ended after " + std::to_string(index) + " elements" : "more than " + std::to_string(index) + " elements",
+                                           ended2 ? "ended after " + std::to_string(index) + " elements" : "more than " + std::to_string(index) + " elements");
+
+            }
+
+        }
+
+        return isEqualRet && ended1 && ended2;
+
+    }
+
+} //namespace isEqualDetail
+
+/*
+ * This function is the meat and potatoes of the best implcit ==operator since sliced bread. (Probably)
+ * Ever compare two floating points and need a tolerance because the darn rounding error got you?
+ * I bet you've opted to use something along the line of fabs(float1 - float2) <= 0.0001 or the likes...
+ * Now have you had to compare two containers of floats, which you assumed would be the same, but weren't?
+ * This function can essentially do the above concept and apply it to any combination of types implcitly.
+ * You have an int and a float? Great we can do that for you in a nice, convenient, small-form factor call.
+ * You have two std::vector<float>s? Great we can do that for you too.
+ * You have a std::vector<float> and a std::vector<double>, but they're so similar you'd expect them to be equal?
+ * Well normally for differing container types likes that, the compiler will sadly make you have to write out
+ * the explicit operator== like this:
+ *
+ *     bool operator==(const std::vector<float>& floatVector, const std::vector<double>& doubleVector){ ... }
+ *
+ * Hmmm... but what if we want the tolerance to be definable? Oops good luck with that without adding a layer of indirection.
+ * Also god-forbid you reversed the order of the float and double, because you'll have to rewrite the entire thing again
+ * to get it compiling for flipping your right and left hand side types. With all these layers of indirection, I think Shrek will be seeing you soon.
+ * This magical isEqual function can do any-order tolerance comparison for free (generally).
+ * You don't want a tolerance? Just supply a 0.0 on a per-case basis, or swap the above TOLERANCE define to: #define TOLERANCE 0.0
+ * Yup, it's that easy.
+ * Want something other than |a - b| <= tolerance? Pass a policy instead of a number: ExactTolerance, RelativeTolerance(1E-9),
+ * UlpTolerance(4) or AbsRelTolerance(1E-12, 1E-9). Whichever it is, each pair of types gets the cheapest arithmetic that's still
+ * correct for it, so two int64_ts past 2^53 never see a double and two floats never get widened at all.
+ * B-b-but what about special types like tuples and pairs? Oh boy if you thought the above operator== nightmare with just
+ * the std::vectors was bad, imagine if you have a bunch of similar sized tuples (and pairs obviously) and you want to compare them to each other?
+ * Ding-ding-ding you're right, you couldn't before, but now you can!
+ * Seriously, it's hard to make this not compile, because if it can fall into the else case, it'll just return false.
+ * If it can't fall into any case, it just won't compile any of the cases into the template during the preprocessor stage and essentially just generate:
+ * bool isEqualRet = false;
+ * return isEqualRet;
+ * Oh, by the way, be careful with pointer types. They can literally compare safely with anything, including a float, funnily enough, so
+ * make sure you're dereferencing things unless they're both pointer types. The one exception is char pointers, which are strings.
+ * Speaking of which, strings of any kind (std::string, std::string_view, char and std::byte vectors, char pointers and literals) get compared
+ * exactly, with memcmp, against each other in any mix. Want "Content-Length" to match "content-length"? Wrap either side in asciiCaseInsensitive.
+ * Both sides are taken by const reference and every recursive call below passes references along, so nothing ever gets copied.
+ * That also means non-owning views work out of the box: C arrays, std::string_view, std::span and ArrayView (for a pointer and a length).
+ * Strided data doesn't need a copy either: StridedView is every n-th element (a column), MatrixView any 2D layout (row-major, column-major,
+ * transposed, a block of something bigger), and a std::vector<std::array<float, 3>> point cloud gets compared as the flat run of floats it is.
+ * Want to know where two things stopped being equal? Pass a MismatchReport as the reporter and it'll hand you a path like
+ * map[36].second -> tuple<2> -> dVector[2] along with both values. The plain isEqual below passes a NoMismatchReport, which
+ * compiles every one of the reporting bits away.
+ */
+template <typename Comparable1, typename Comparable2, typename Tolerance, typename Reporter>
+static constexpr std::enable_if_t<!std::is_arithmetic_v<Tolerance>, bool>
+isEqualWith(const Comparable1& comparable1, const Comparable2& comparable2, const Tolerance& tolerance, Reporter& reporter){
+
+    bool isEqualRet = false;
+
+    isEqualDetail::enterComparison(reporter);
+
+    //Hashed containers (i.e. a std::unordered_map<int, float> with a std::unordered_map<int, double> or even a std::map<int, double>) can't be walked
+    //side by side, so we walk one and look each key up, exactly, in the other (the hashed one, unless only the other's keys convert the right way).
+    //That's O(n) on average with no scratch memory at all. Multimaps and multisets get every key's entries looked up at once, see isEqualKeyGroup.
+    if constexpr(isEqualDetail::is_lookup_comparable<Comparable1, Comparable2>::value){
+
+        isEqualDetail::countBranch(reporter, ComparisonBranch::Lookup);
+
+        isEqualRet = (isEqualDetail::adlSize(comparable1) == isEqualDetail::adlSize(comparable2));
+
+        if constexpr(Reporter::enabled){
+
+            if(!isEqualRet){
+
+                reporter.recordDescription("size " + std::to_string(isEqualDetail::adlSize(comparable1)),
+                                           "size " + std::to_string(isEqualDetail::adlSize(comparable2)));
+
+            }
+
+        }
+
+        //Equal sizes and unique keys on both sides means finding every key of one side in the other is enough.
+        //Swapped says whether walked is comparable2, so values and reports still come out in the caller's order.
+        auto compareByLookup = [&isEqualRet, &tolerance, &reporter](const auto& walked, const auto& lookedUp, auto swapped){
+
+            using Walked   = std::decay_t<decltype(walked)>;
+            using LookedUp = std::decay_t<decltype(lookedUp)>;
+
+            //Equal sizes again, and every key holding as many entries on both sides (and equal ones) covers everything
+            if constexpr(!isEqualDetail::is_unique_key<Walked>::value || !isEqualDetail::is_unique_key<LookedUp>::value){
+
+                for(auto walkedIter = walked.begin(); isEqualDetail::keepScanning(isEqualRet, reporter) && (walkedIter != walked.end());){
+
+                    const auto& key           = isEqualDetail::entryKey<Walked>(walkedIter);
+                    auto        walkedRange   = walked.equal_range(key);
+                    auto        lookedUpRange = isEqualDetail::equalRangeExactKey(lookedUp, key);
+
+                    bool elementEqual = isEqualDetail::isEqualKeyGroup<Walked>(walkedRange, lookedUpRange, tolerance, swapped);
+
+                    if constexpr(Reporter::enabled){
+
+                        if(!elementEqual){
+
+                            auto walkedEntries   = std::distance(walkedRange.first, walkedRange.second);
+                            auto lookedUpEntries = std::distance(lookedUpRange.first, lookedUpRange.second);
+
+                            //The same count on both sides means the values were what didn't pair off
+                            std::size_t reportedSoFar = reporter.count();
+                            std::string walkedCount   = std::to_string(walkedEntries) + " entries";
+                            std::string lookedUpCount = std::to_string(lookedUpEntries) + (walkedEntries == lookedUpEntries ? " entries, not all equal" : " entries");
+
+                            reporter.recordDescription(decltype(swapped)::value ? lookedUpCount : walkedCount, decltype(swapped)::value ? walkedCount : lookedUpCount);
+                            reporter.addFrame(reportedSoFar, MismatchFrame::Kind::Element, isEqualDetail::containerName<Walked>(),
+                                              "[" + isEqualDetail::describeValue(key) + "]");
+
+                        }
+
+                    }
+
+                    isEqualRet = isEqualRet && elementEqual;
+                    walkedIter = walkedRange.second;
+
+                }
+
+            }
+            else{
+
+                for(auto walkedIter = walked.begin(); isEqualDetail::keepScanning(isEqualRet, reporter) && (walkedIter != walked.end()); ++walkedIter){
+
+                    bool        elementEqual = false;
+                    std::size_t reportedSoFar = 0;
+
+                    if constexpr(Reporter::enabled){
+
+                        reportedSoFar = reporter.count();
+
+                    }
+
+                    if constexpr(is_unordered_map<Walked>::value || is_map<Walked>::value){
+
+                        auto lookedUpIter = isEqualDetail::findExactKey(lookedUp, walkedIter->first);
+
+                        //The values still get the usual tolerance treatment, only the keys have to match exactly.
+                        //(Careful with == on these iterators, the catch-all operator== that EqualExists relies on wins overload resolution against them)
+                        if(lookedUpIter != lookedUp.end()){
+
+                            if constexpr(decltype(swapped)::value){
+
+                                elementEqual = isEqualWith(lookedUpIter->second, walkedIter->second, tolerance, reporter);
+
+                            }
+                            else{
+
+                                elementEqual = isEqualWith(walkedIter->second, lookedUpIter->second, tolerance, reporter);
+
+                            }
+
+                        }
+                        else if constexpr(Reporter::enabled){
+
+                            reporter.recordDescription(decltype(swapped)::value ? "missing" : "present", decltype(swapped)::value ? "present" : "missing");
+
+                        }
+
+                        if constexpr(Reporter::enabled){
+
+                            if(!elementEqual){
+
+                                reporter.addFrame(reportedSoFar, MismatchFrame::Kind::Element, isEqualDetail::containerName<Walked>(),
+                                                  "[" + isEqualDetail::describeValue(walkedIter->first) + "]");
+
+                            }
+
+                        }
+
+                    }
+                    else{
+
+                        elementEqual = (isEqualDetail::findExactKey(lookedUp, *walkedIter) != lookedUp.end());
+
+                        if constexpr(Reporter::enabled){
+
+                            if(!elementEqual){
+
+                                reporter.recordDescription(decltype(swapped)::value ? "missing" : "present", decltype(swapped)::value ? "present" : "missing");
+                                reporter.addFrame(reportedSoFar, MismatchFrame::Kind::Element, isEqualDetail::containerName<Walked>(),
+                                                  "[" + isEqualDetail::describeValue(*walkedIter) + "]");
+
+                            }
+
+                        }
+
+                    }
+
+                    isEqualRet = isEqualRet && elementEqual;
+
+                }
+
+            }
+
+        };
+
+        if constexpr(isEqualDetail::lookup_direction<Comparable1, Comparable2>::intoComparable2){
+
+            compareByLookup(comparable1, comparable2, std::false_type{});
+
+        }
+        else{
+
+            compareByLookup(comparable2, comparable1, std::true_type{});
+
+        }
+
+    }
+    //If we have mismatched map types but technically "could" be compared (i.e. a std::map<int, float> with a std::map<int, double> or a std::map<int, int>)
+    //Ordered sets land in here too, their elements are already sorted so lining them up by position is all it takes.
+    //Keys (and set elements) have to match exactly, just like they do when they're looked up, only the values get the tolerance
+    else if constexpr((is_map<Comparable1>::value && is_map<Comparable2>::value) || (is_set<Comparable1>::value && is_set<Comparable2>::value)){
+
+            isEqualDetail::countBranch(reporter, ComparisonBranch::Map);
+
+            //We should have a strict requirement of having a size since there's no standard for every container type
+            isEqualRet = (isEqualDetail::adlSize(comparable1) == isEqualDetail::adlSize(comparable2));
+
+            if constexpr(Reporter::enabled){
+
+                if(!isEqualRet){
+
+                    reporter.recordDescription("size " + std::to_string(isEqualDetail::adlSize(comparable1)),
+                                               "size " + std::to_string(isEqualDetail::adlSize(comparable2)));
+
+                }
+
+            }
+
+            size_t indexError(0);
+
+            //We also had a strict requirement that the begin() and end() operators were to be defined
+            //Declared apart since the two iterator types differ whenever the two map types do
+            auto comparable2Iter = isEqualDetail::adlBegin(comparable2);
+
+            for(auto comparable1Iter = isEqualDetail::adlBegin(comparable1);
+                isEqualDetail::keepScanning(isEqualRet, reporter) && (comparable1Iter != isEqualDetail::adlEnd(comparable1)) && (comparable2Iter != isEqualDetail::adlEnd(comparable2));
+                ++comparable1Iter, ++comparable2Iter){
+
+                std::size_t reportedSoFar = 0;
+
+                if constexpr(Reporter::enabled){
+
+                    reportedSoFar = reporter.count();
+
+                }
+
+                bool elementEqual = isEqualDetail::isExactKey(isEqualDetail::entryKey<Comparable1>(comparable1Iter), isEqualDetail::entryKey<Comparable2>(comparable2Iter));
+
+                if constexpr(Reporter::enabled){
+
+                    if(!elementEqual){
+
+                        reporter.recordDescription("key " + isEqualDetail::describeValue(isEqualDetail::entryKey<Comparable1>(comparable1Iter)),
+                                                   "key " + isEqualDetail::describeValue(isEqualDetail::entryKey<Comparable2>(comparable2Iter)));
+
+                    }
+
+                }
+
+                //This is crazy that we can call ourself (on the whole entry, so a report still says .second)
+                if constexpr(is_map<Comparable1>::value){
+
+                    elementEqual = elementEqual && isEqualWith(*comparable1Iter, *comparable2Iter, tolerance, reporter);
+
+                }
+
+                //Maps get tagged with their key, sets with the position, since their element is the key
+                if constexpr(Reporter::enabled){
+
+                    if(!elementEqual){
+
+                        if constexpr(is_map<Comparable1>::value){
+
+                            reporter.addFrame(reportedSoFar, MismatchFrame::Kind::Element, isEqualDetail::containerName<Comparable1>(),
+                                              "[" + isEqualDetail::describeValue(comparable1Iter->first) + "]");
+
+                        }
+                        else{
+
+                            reporter.addFrame(reportedSoFar, MismatchFrame::Kind::Element, isEqualDetail::containerName<Comparable1>(),
+                                              "[" + std::to_string(indexError) + "]");
+
+                        }
+
+                    }
+
+                }
+
+                isEqualRet = isEqualRet && elementEqual;
+
+                ++indexError;
+
+            }
+
+    }
+    //Strings (std::string, std::string_view, char and std::byte vectors, char pointers and literals) in any mix, compared exactly with memcmp.
+    //Going through the iterable branch below would make every character a number, and 'a' equal to 'b' with a tolerance of 1.
+    else if constexpr(isEqualDetail::is_string_pair<Comparable1, Comparable2>::value){
+
+        (void) tolerance;
+        isEqualDetail::countBranch(reporter, ComparisonBranch::String, isEqualDetail::string_traits<Comparable1>::length(comparable1),
+                                   isEqualDetail::string_traits<Comparable1>::length(comparable1) * sizeof(isEqualDetail::string_unit_t<Comparable1>));
+
+        isEqualRet = isEqualDetail::compareStrings(comparable1, comparable2);
+
+        if constexpr(Reporter::enabled){
+
+            if(!isEqualRet){
+
+                using Traits1 = isEqualDetail::string_traits<Comparable1>;
+                using Traits2 = isEqualDetail::string_traits<Comparable2>;
+
+                std::size_t length1 = Traits1::length(comparable1);
+                std::size_t length2 = Traits2::length(comparable2);
+
+                if(Traits1::isNull(comparable1) || Traits2::isNull(comparable2)){
+
+                    reporter.recordDescription(Traits1::isNull(comparable1) ? "nullptr" : "length " + std::to_string(length1),
+                                               Traits2::isNull(comparable2) ? "nullptr" : "length " + std::to_string(length2));
+
+                }
+                else if(length1 != length2){
+
+                    reporter.recordDescription("length " + std::to_string(length1), "length " + std::to_string(length2));
+
+                }
+                else{
+
+                    std::size_t reportedSoFar = reporter.count();
+                    std::size_t index         = isEqualDetail::firstStringDifference(Traits1::data(comparable1), Traits2::data(comparable2), length1,
+                                                                                     Traits1::caseInsensitive || Traits2::caseInsensitive);
+
+                    reporter.recordDescription(isEqualDetail::describeCodeUnit(Traits1::data(comparable1)[index]),
+                                               isEqualDetail::describeCodeUnit(Traits2::data(comparable2)[index]));
+                    reporter.addFrame(reportedSoFar, MismatchFrame::Kind::Element, "string", "[" + std::to_string(index) + "]");
+
+                }
+
+            }
+
+        }
+
+    }
+    //iterable containers, like std::vector or std::lists can natively be compared to each other here
+    else if constexpr(is_iterable<Comparable1>::value && is_iterable<Comparable2>::value){
+
+        //We should have a strict requirement of having a size since there's no standard for every container type
+        isEqualRet = (isEqualDetail::adlSize(comparable1) == isEqualDetail::adlSize(comparable2));
+
+        if constexpr(Reporter::enabled){
+
+            if(!isEqualRet){
+
+                reporter.recordDescription("size " + std::to_string(isEqualDetail::adlSize(comparable1)),
+                                           "size " + std::to_string(isEqualDetail::adlSize(comparable2)));
+
+            }
+
+        }
+
+        //Small std::arrays of the same length get unrolled (through the tuple machinery, std::get works on them too),
+        //which beats dispatching to a kernel for a handful of elements and folds away entirely in a constant expression
+        if constexpr(!Reporter::enabled && isEqualDetail::is_unrollable_array_pair<Comparable1, Comparable2>::value){
+
+            isEqualDetail::countBranch(reporter, ComparisonBranch::UnrolledArray);
+
+            for_each_tuple_element(comparable1, comparable2, [&isEqualRet, &tolerance, &reporter](auto&& i, auto&& s){
+
+                isEqualRet = isEqualRet && isEqualWith(i, s, tolerance, reporter);
+
+            });
+
+        }
+        //Two flat runs of numbers (i.e. a std::vector<float> and a std::vector<double>) don't need to recurse per element at all,
+        //and neither do two flat runs of integers (or enums, or padding free aggregates of them), which can even be compared byte for byte.
+        //Runs of fixed size arrays of numbers (point clouds, small matrices...) are flat runs of numbers too, just longer ones.
+        else if constexpr((is_contiguous_arithmetic<Comparable1>::value && is_contiguous_arithmetic<Comparable2>::value) ||
+                          isEqualDetail::is_flattenable_range_pair<Comparable1, Comparable2>::value                       ||
+                          isEqualDetail::is_bitwise_comparable_range<Comparable1, Comparable2>::value){
+
+            //Nothing gets scanned when the sizes already differ
+            std::size_t scanned = isEqualRet ? isEqualDetail::adlSize(comparable1) : 0;
+
+            isEqualDetail::countBranch(reporter, ComparisonBranch::ContiguousRange,
+                                       scanned, scanned * (sizeof(isEqualDetail::range_element_t<Comparable1>) + sizeof(isEqualDetail::range_element_t<Comparable2>)));
+
+            if constexpr(isEqualDetail::is_flattenable_range_pair<Comparable1, Comparable2>::value){
+
+                isEqualRet = isEqualRet && isEqualDetail::compareFlattened(comparable1, comparable2, tolerance);
+
+            }
+            else{
+
+                isEqualRet = isEqualRet && isEqualDetail::compareContiguousRange(isEqualDetail::adlData(comparable1),
+                                                                                 isEqualDetail::adlData(comparable2),
+                                                                                 isEqualDetail::adlSize(comparable1),
+                                                                                 tolerance);
+
+            }
+
+            //The fast paths only say yes or no, so only once they've said no do we go back and find out where
+            if constexpr(Reporter::enabled){
+
+                if(!isEqualRet){
+
+                    std::size_t commonSize = std::min<std::size_t>(isEqualDetail::adlSize(comparable1), isEqualDetail::adlSize(comparable2));
+
+                    for(std::size_t index = 0; index < commonSize && reporter.wantsMore(); ++index){
+
+                        std::size_t reportedSoFar = reporter.count();
+
+                        if(!isEqualWith(isEqualDetail::adlData(comparable1)[index], isEqualDetail::adlData(comparable2)[index], tolerance, reporter)){
+
+                            reporter.addFrame(reportedSoFar, MismatchFrame::Kind::Element, isEqualDetail::containerName<Comparable1>(), "[" + std::to_string(index) + "]");
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+        }
+        //Columns and other strided runs of numbers get gathered into the kernels a chunk at a time (a report still goes element by element below)
+        else if constexpr(!Reporter::enabled && isEqualDetail::is_strided_arithmetic_pair<Comparable1, Comparable2>::value){
+
+            std::size_t scanned = isEqualRet ? isEqualDetail::adlSize(comparable1) : 0;
+
+            isEqualDetail::countBranch(reporter, ComparisonBranch::StridedRange,
+                                       scanned, scanned * (sizeof(isEqualDetail::range_element_t<Comparable1>) + sizeof(isEqualDetail::range_element_t<Comparable2>)));
+
+            isEqualRet = isEqualRet && isEqualDetail::compareStridedRange(isEqualDetail::stridedStart(comparable1), isEqualDetail::stridedStep(comparable1),
+                                                                          isEqualDetail::stridedStart(comparable2), isEqualDetail::stridedStep(comparable2),
+                                                                          isEqualDetail::adlSize(comparable1), tolerance);
+
+        }
+        //Runs of halves, bfloat16s or quantized integers against runs of floats or doubles (or each other) get widened a vector at a time,
+        //rather than copied into a std::vector<float> first or walked element by element (a report still goes element by element below)
+        else if constexpr(!Reporter::enabled && isEqualDetail::is_reduced_range_pair<Comparable1, Comparable2>::value){
+
+            std::size_t scanned = isEqualRet ? isEqualDetail::adlSize(comparable1) : 0;
+
+            isEqualDetail::countBranch(reporter, ComparisonBranch::ReducedRange,
+                                       scanned, scanned * (isEqualDetail::storedElementSize<Comparable1>() + isEqualDetail::storedElementSize<Comparable2>()));
+
+            isEqualRet = isEqualRet && isEqualDetail::compareReducedRange(comparable1, comparable2, 0, isEqualDetail::adlSize(comparable1), tolerance);
+
+        }
+        else{
+
+            isEqualDetail::countBranch(reporter, ComparisonBranch::Iterable);
+
+            std::size_t index(0);
+
+            //We also had a strict requirement that the begin() and end() operators were to be defined
+            //Declared apart since the two iterator types can differ (i.e. a std::vector<float> iterator walking alongside a std::list<int> one)
+            auto comparable2Iter = isEqualDetail::adlBegin(comparable2);
+
+            for(auto comparable1Iter = isEqualDetail::adlBegin(comparable1);
+                isEqualDetail::keepScanning(isEqualRet, reporter) && (comparable1Iter != isEqualDetail::adlEnd(comparable1)) && (comparable2Iter != isEqualDetail::adlEnd(comparable2));
+                ++comparable1Iter, ++comparable2Iter){
+
+                std::size_t reportedSoFar = 0;
+
+                if constexpr(Reporter::enabled){
+
+                    reportedSoFar = reporter.count();
+
+                }
+
+                //We also needed the *operator defined so we can dereference the iterator
+                bool elementEqual = isEqualWith(*comparable1Iter, *comparable2Iter, tolerance, reporter);
+
+                if constexpr(Reporter::enabled){
+
+                    if(!elementEqual){
+
+                        reporter.addFrame(reportedSoFar, MismatchFrame::Kind::Element, isEqualDetail::containerName<Comparable1>(), "[" + std::to_string(index) + "]");
+
+                    }
+
+                }
+
+                isEqualRet = isEqualRet && elementEqual;
+
+                ++index;
+
+            }
+
+        }
+
+    }
+    //Anything that can only be walked once (or just doesn't know its size), like a std::forward_list, gets walked in lockstep instead
+    else if constexpr(is_single_pass_iterable<Comparable1>::value && is_single_pass_iterable<Comparable2>::value){
+
+        isEqualDetail::countBranch(reporter, ComparisonBranch::SinglePass);
+
+        isEqualRet = isEqualDetail::compareLockstep(isEqualDetail::adlBegin(comparable1), isEqualDetail::adlEnd(comparable1),
+                                                    isEqualDetail::adlBegin(comparable2), isEqualDetail::adlEnd(comparable2),
+                                                    tolerance, reporter, "iterable");
+
+    }
+    //Two MatrixViews line up by (row, column), whatever their strides are
+    else if constexpr(isEqualDetail::is_matrix_view<Comparable1>::value && isEqualDetail::is_matrix_view<Comparable2>::value){
+
+        isEqualRet = (comparable1.rows() == comparable2.rows() && comparable1.columns() == comparable2.columns());
+
+        if constexpr(Reporter::enabled){
+
+            if(!isEqualRet){
+
+                reporter.recordDescription(std::to_string(comparable1.rows()) + "x" + std::to_string(comparable1.columns()),
+                                           std::to_string(comparable2.rows()) + "x" + std::to_string(comparable2.columns()));
+
+            }
+
+            for(std::size_t row = 0; isEqualRet || reporter.wantsMore(); ++row){
+
+                if(row >= std::min(comparable1.rows(), comparable2.rows())){
+
+                    break;
+
+                }
+
+                for(std::size_t column = 0; column < std::min(comparable1.columns(), comparable2.columns()) && isEqualDetail::keepScanning(isEqualRet, reporter); ++column){
+
+                    std::size_t reportedSoFar = reporter.count();
+
+                    if(!isEqualWith(comparable1(row, column), comparable2(row, column), tolerance, reporter)){
+
+                        isEqualRet = false;
+                        reporter.addFrame(reportedSoFar, MismatchFrame::Kind::Element, "matrix", "[" + std::to_string(row) + "][" + std::to_string(column) + "]");
+
+                    }
+
+                }
+
+            }
+
+        }
+        else{
+
+            std::size_t scanned = isEqualRet ? comparable1.rows() * comparable1.columns() : 0;
+
+            isEqualDetail::countBranch(reporter, ComparisonBranch::Matrix,
+                                       scanned, scanned * (sizeof(comparable1(0, 0)) + sizeof(comparable2(0, 0))));
+
+            isEqualRet = isEqualRet && isEqualDetail::compareMatrixViews(comparable1, comparable2, tolerance);
+
+        }
+
+    }
+    else if constexpr( std::is_null_pointer_v<Comparable1> && std::is_null_pointer_v<Comparable2> ){
+
+        (void) tolerance;
+        isEqualDetail::countBranch(reporter, ComparisonBranch::Nullptr);
+        isEqualRet = true;
+
+    }
+    else if constexpr( std::is_fundamental<Comparable1>::value && std::is_fundamental<Comparable2>::value ){
+
+        isEqualDetail::countBranch(reporter, ComparisonBranch::Fundamental, 1, sizeof(Comparable1) + sizeof(Comparable2));
+
+        isEqualRet = isEqualDetail::isWithinTolerance(comparable1, comparable2, tolerance);
+
+        if constexpr(Reporter::enabled){
+
+            if(!isEqualRet){
+
+                reporter.recordValues(comparable1, comparable2);
+
+            }
+
+        }
+
+    }
+    //Halves and bfloat16s are compared as the floats they widen to (exactly), so from here on they're just two numbers
+    else if constexpr(isEqualDetail::is_reduced_number_pair<Comparable1, Comparable2>::value){
+
+        isEqualDetail::countBranch(reporter, ComparisonBranch::Fundamental, 1, sizeof(Comparable1) + sizeof(Comparable2));
+
+        auto widened1 = isEqualDetail::widenReduced(comparable1);
+        auto widened2 = isEqualDetail::widenReduced(comparable2);
+
+        isEqualRet = isEqualDetail::isWithinTolerance(widened1, widened2, tolerance);
+
+        if constexpr(Reporter::enabled){
+
+            if(!isEqualRet){
+
+                reporter.recordValues(widened1, widened2);
+
+            }
+
+        }
+
+    }
+    //The tuple or pair can be of any type we want, even with differing lengths and we can handle it through the following constexprs
+    else if constexpr( (is_pair<Comparable1>::value || is_tuple<Comparable1>::value) || (is_pair<Comparable2>::value || is_tuple<Comparable2>::value) ){
+
+        isEqualDetail::countBranch(reporter, ComparisonBranch::Tuple);
+
+        isEqualRet = std::tuple_size<Comparable1>::value == std::tuple_size<Comparable2>::value;
+
+        size_t indexError(0);
+
+        if constexpr( std::tuple_size<Comparable1>::value == std::tuple_size<Comparable2>::value){
+
+            for_each_tuple_element(comparable1, comparable2, [&isEqualRet, &tolerance, &indexError, &reporter](auto&& i, auto&& s){
+
+                if(isEqualDetail::keepScanning(isEqualRet, reporter)){
+
+                    std::size_t reportedSoFar = 0;
+
+                    if constexpr(Reporter::enabled){
+
+                        reportedSoFar = reporter.count();
+
+                    }
+
+                    bool elementEqual = isEqualWith(i, s, tolerance, reporter);
+
+                    //Pairs read better as .first and .second, tuples get their index
+                    if constexpr(Reporter::enabled){
+
+                        if(!elementEqual && is_pair<Comparable1>::value){
+
+                            reporter.addFrame(reportedSoFar, MismatchFrame::Kind::PairMember, std::string(), indexError == 0 ? ".first" : ".second");
+
+                        }
+                        else if(!elementEqual){
+
+                            reporter.addFrame(reportedSoFar, MismatchFrame::Kind::TupleElement, std::string(), "tuple<" + std::to_string(indexError) + ">");
+
+                        }
+
+                    }
+
+                    isEqualRet = isEqualRet && elementEqual;
+
+                }
+
+                ++indexError;
+
+            });
+
+        }
+        else if constexpr(Reporter::enabled){
+
+            reporter.recordDescription(std::to_string(std::tuple_size<Comparable1>::value) + " elements",
+                                       std::to_string(std::tuple_size<Comparable2>::value) + " elements");
+
+        }
+
+    }
+    //Types that expose their members (see has_member_comparison) get compared member by member, so reports can name the member that differed
+    else if constexpr( std::is_same<Comparable1, Comparable2>::value && isEqualDetail::has_member_comparison<Comparable1, Tolerance, Reporter>::value ){
+
+            isEqualDetail::countBranch(reporter, ComparisonBranch::Members);
+
+            isEqualRet = comparable1.isEqualMembers(comparable2, tolerance, reporter);
+
+    }
+    else if constexpr( EqualExists<Comparable1>::value && std::is_same<Comparable1, Comparable2>::value && !std::is_fundamental<Comparable1>::value){
+
+            (void) tolerance;
+            isEqualDetail::countBranch(reporter, ComparisonBranch::EqualityOperator, 1, sizeof(Comparable1) + sizeof(Comparable2));
+            isEqualRet = comparable1 == comparable2;
+
+            if constexpr(Reporter::enabled){
+
+                if(!isEqualRet){
+
+                    reporter.recordValues(comparable1, comparable2);
+
+                }
+
+            }
+
+    }
+    //Either Comparable1 is iterable and Comparable2 is not, or vice versa
+    else{        
+
+        //Unused warning suppression for when the else case is compiled
+        (void) comparable1;
+        (void) comparable2;
+        (void) tolerance;        
+
+        isEqualDetail::countBranch(reporter, ComparisonBranch::Incompatible);
+
+        //Types are incompatible, this will always return false
+        if constexpr(Reporter::enabled){
+
+            reporter.recordDescription("incompatible type: " + isEqualDetail::describeValue(comparable1),
+                                       "incompatible type: " + isEqualDetail::describeValue(comparable2));
+
+        }
+
+        isEqualRet = false;
+
+    }
+
+    isEqualDetail::leaveComparison(reporter, isEqualRet);
+
+    return isEqualRet;
+
+}
+
+//A plain number as the tolerance, which means an AbsoluteTolerance of that much
+template <typename Comparable1, typename Comparable2, typename Arithmetic, typename Reporter>
+static constexpr std::enable_if_t<std::is_arithmetic_v<Arithmetic>, bool>
+isEqualWith(const Comparable1& comparable1, const Comparable2& comparable2, Arithmetic tolerance, Reporter& reporter){
+
+    return isEqualWith(comparable1, comparable2, AbsoluteTolerance(static_cast<double>(tolerance)), reporter);
+
+}
+
+//The plain boolean version, which is just isEqualWith with every reporting hook compiled away
+template <typename Comparable1, typename Comparable2, typename Tolerance = AbsoluteTolerance>
+static constexpr bool isEqual(const Comparable1& comparable1, const Comparable2& comparable2, const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE)){ //0.00001
+
+    NoMismatchReport noReport{};
+
+    return isEqualWith(comparable1, comparable2, tolerance, noReport);
+
+}
+
+//Compares one named member of two objects from inside an isEqualMembers, so the member's name ends up in the report path
+template <typename Member1, typename Member2, typename Tolerance, typename Reporter>
+static constexpr bool isEqualMember(const char* memberName, const Member1& member1, const Member2& member2, const Tolerance& tolerance, Reporter& reporter){
+
+    std::size_t reportedSoFar = 0;
+
+    if constexpr(Reporter::enabled){
+
+        reportedSoFar = reporter.count();
+
+    }
+
+    bool isEqualRet = isEqualWith(member1, member2, tolerance, reporter);
+
+    if constexpr(Reporter::enabled){
+
+        if(!isEqualRet){
+
+            reporter.addFrame(reportedSoFar, MismatchFrame::Kind::Member, std::string(), memberName);
+
+        }
+
+    }
+    else{
+
+        (void) memberName;
+
+    }
+
+    return isEqualRet;
+
+}
+
+/*
+ * Streaming versions, for sequences that can only be read once and whose length isn't known until they run out: istream_iterators
+ * over a decompressed log, C++20 input views, a socket reader... Both sides get walked in lockstep, one element at a time, so nothing
+ * is buffered no matter how long they are, and a length mismatch shows up as soon as one side ends before the other.
+ */
+template <typename Iterator1, typename Sentinel1, typename Iterator2, typename Sentinel2, typename Tolerance, typename Reporter>
+constexpr bool isEqualStreamWith(Iterator1 first1, Sentinel1 last1, Iterator2 first2, Sentinel2 last2, const Tolerance& tolerance, Reporter& reporter){
+
+    return isEqualDetail::compareLockstep(std::move(first1), std::move(last1), std::move(first2), std::move(last2),
+                                          isEqualDetail::toTolerancePolicy(tolerance), reporter, "stream");
+
+}
+
+template <typename Iterator1, typename Sentinel1, typename Iterator2, typename Sentinel2, typename Tolerance = AbsoluteTolerance>
+constexpr bool isEqualStream(Iterator1 first1, Sentinel1 last1, Iterator2 first2, Sentinel2 last2, const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE)){
+
+    NoMismatchReport noReport{};
+
+    return isEqualStreamWith(std::move(first1), std::move(last1), std::move(first2), std::move(last2), tolerance, noReport);
+
+}
+
+//Whole ranges, taken by forwarding reference since plenty of input views (a C++20 istream_view, say) can only begin() when they aren't const
+template <typename Range1, typename Range2, typename Tolerance = AbsoluteTolerance>
+constexpr bool isEqualStream(Range1&& range1, Range2&& range2, const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE)){
+
+    using std::begin;
+    using std::end;
+
+    return isEqualStream(begin(range1), end(range1), begin(range2), end(range2), tolerance);
+
+}
+
+/*
+ * And for generators: anything callable that hands back a std::optional (or anything else that converts to bool and
+ * dereferences to the value) with the next element, and an empty one once it's done, i.e.
+ *
+ *     auto readNext = [&socket]() -> std::optional<double> { ... };
+ */
+template <typename Generator1, typename Generator2, typename Tolerance = AbsoluteTolerance>
+inline bool isEqualGenerated(Generator1&& generator1, Generator2&& generator2, const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE)){
+
+    const auto policy = isEqualDetail::toTolerancePolicy(tolerance);
+
+    while(true){
+
+        auto next1 = generator1();
+        auto next2 = generator2();
+
+        if(!next1 || !next2){
+
+            //Equal only if they ran out together
+            return !next1 && !next2;
+
+        }
+
+        if(!isEqual(*next1, *next2, policy)){
+
+            return false;
+
+        }
+
+    }
+
+}
+
+//Knobs for isEqualParallel, the defaults are meant to be sane on anything from a laptop to a 64 core comparison host.
+//The memory resource gets the per call scratch (chunk ranges, map chunk starts, batch result words), all of it allocated on the
+//calling thread before any worker starts, so an unsynchronized arena is fine. The std::threads themselves still get their
+//bookkeeping from the global heap though, so latency critical callers want threadCount = 1 there.
+//A thread that can't be started (std::system_error once the system is out of them, std::bad_alloc for its state...) just means fewer
+//workers, the calling thread steals whatever it would have compared. An exception out of a comparison cancels the rest and gets rethrown,
+//once every worker has been joined.
+struct ParallelOptions{
+
+    std::size_t                threadCount     = 0;         //0 means std::thread::hardware_concurrency()
+    std::size_t                minimumElements = 1 << 18;   //anything smaller than this just runs the sequential isEqual
+    std::size_t                chunkElements   = 1 << 15;   //how many elements a worker grabs (or steals) at a time
+    std::pmr::memory_resource* memoryResource  = nullptr;   //nullptr means std::pmr::get_default_resource()
+
+    std::pmr::memory_resource* resource() const{ return memoryResource ? memoryResource : std::pmr::get_default_resource(); }
+
+};
+
+namespace isEqualDetail{
+
+    template <typename Iterable>
+    using iterator_category_of = typename std::iterator_traits<decltype(adlBegin(std::declval<const Iterable&>()))>::iterator_category;
+
+    template <typename Iterable, typename = void>
+    struct is_random_access_iterable : std::false_type {};
+
+    template <typename Iterable>
+    struct is_random_access_iterable<Iterable, std::void_t<iterator_category_of<Iterable>>>
+        : std::is_base_of<std::random_access_iterator_tag, iterator_category_of<Iterable>> {};
+
+    //One per worker, a worker pops chunks off the front of its own range and, once that's dry, steals from the front of everyone else's.
+    //Owners and thieves both just fetch_add the same counter, so a chunk can never be handed out twice.
+    struct alignas(64) ChunkRange{
+
+        std::atomic<std::size_t> nextChunk{0};
+        std::size_t              endChunk = 0;
+
+    };
+
+    /*
+     * Runs compareChunk(chunkIndex) over [0, chunkCount) on threadCount threads (the calling thread being one of them).
+     * The first chunk to come back false flips mismatchFound, and every worker checks that flag before taking another chunk,
+     * so the remaining chunks get cancelled instead of compared. The first exception out of compareChunk, on whichever thread,
+     * cancels them the same way and is rethrown on the calling thread after the joins (a std::thread left joinable would terminate).
+     */
+    template <typename CompareChunk>
+    bool runChunksInParallel(std::size_t chunkCount, std::size_t threadCount, std::pmr::memory_resource* resource, const CompareChunk& compareChunk){
+
+        threadCount = std::max<std::size_t>(1, std::min(threadCount, chunkCount));
+
+        std::pmr::vector<ChunkRange> chunkRanges(threadCount, resource);
+        std::atomic<bool>            mismatchFound(false);
+
+        for(std::size_t worker = 0; worker < threadCount; ++worker){
+
+            chunkRanges[worker].nextChunk = chunkCount *  worker      / threadCount;
+            chunkRanges[worker].endChunk  = chunkCount * (worker + 1) / threadCount;
+
+        }
+
+        //Only ever written by the one worker that wins failureTaken, and only read after the joins
+        std::exception_ptr failure;
+        std::atomic<bool>  failureTaken(false);
+
+        auto runWorker = [&](std::size_t worker){
+
+            try{
+
+                for(std::size_t victim = 0; victim < threadCount && !mismatchFound.load(std::memory_order_relaxed); ++victim){
+
+                    //Start with our own range, then walk around the others
+                    ChunkRange& chunkRange = chunkRanges[(worker + victim) % threadCount];
+
+                    while(!mismatchFound.load(std::memory_order_relaxed)){
+
+                        std::size_t chunkIndex = chunkRange.nextChunk.fetch_add(1, std::memory_order_relaxed);
+
+                        if(chunkIndex >= chunkRange.endChunk){
+
+                            break;
+
+                        }
+
+                        if(!compareChunk(chunkIndex)){
+
+                            mismatchFound.store(true, std::memory_order_relaxed);
+
+                        }
+
+                    }
+
+                }
+
+            }
+            catch(...){
+
+                if(!failureTaken.exchange(true)){
+
+                    failure = std::current_exception();
+
+                }
+
+                mismatchFound.store(true, std::memory_order_relaxed);
+
+            }
+
+        };
+
+        std::pmr::vector<std::thread> workers(resource);
+        workers.reserve(threadCount - 1);
+
+        for(std::size_t worker = 1; worker < threadCount; ++worker){
+
+            //Every range gets stolen from sooner or later, so the ones we couldn't start a thread for still get compared. Nothing gets
+            //out of here, it would destroy the workers already started (std::terminate) while they still use this stack frame
+            try{
+
+                workers.emplace_back(runWorker, worker);
+
+            }
+            catch(...){
+
+                break;
+
+            }
+
+        }
+
+        runWorker(0);
+
+        for(std::thread& workerThread : workers){
+
+            workerThread.join();
+
+        }
+
+        if(failure){
+
+            std::rethrow_exception(failure);
+
+        }
+
+        return !mismatchFound.load();
+
+    }
+
+} //namespace isEqualDetail
+
+/*
+ * Same answers as isEqual, just spread across cores for the containers where that pays off:
+ *  - random access iterables (std::vector, std::array, std::deque, C arrays, views...) get cut into index ranges,
+ *    and contiguous arithmetic (or half, bfloat16, quantized and point cloud) ones still go through the vectorized kernels chunk by chunk
+ *  - maps get one sequential walk to find where each chunk starts in both maps, then the pairs themselves
+ *    (which is where the time goes for something like a std::map<int, std::vector<double>>) get compared in parallel
+ * Anything else, or anything smaller than options.minimumElements, is simply handed to the sequential isEqual.
+ */
+template <typename Comparable1, typename Comparable2, typename Tolerance = AbsoluteTolerance>
+inline bool isEqualParallel(const Comparable1& comparable1, const Comparable2& comparable2, const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE),
+                            const ParallelOptions& options = ParallelOptions()){
+
+    //Converted once up front, rather than by every isEqual call inside every chunk
+    const auto policy = isEqualDetail::toTolerancePolicy(tolerance);
+
+    std::size_t threadCount = options.threadCount ? options.threadCount : std::max(1u, std::thread::hardware_concurrency());
+    std::size_t chunkSize   = std::max<std::size_t>(1, options.chunkElements);
+
+    if constexpr(is_map<Comparable1>::value && is_map<Comparable2>::value){
+
+        std::size_t elementCount = isEqualDetail::adlSize(comparable1);
+
+        if(elementCount != isEqualDetail::adlSize(comparable2)){
+
+            return false;
+
+        }
+
+        if(threadCount <= 1 || elementCount < options.minimumElements){
+
+            return isEqual(comparable1, comparable2, policy);
+
+        }
+
+        using Iterator1 = decltype(isEqualDetail::adlBegin(comparable1));
+        using Iterator2 = decltype(isEqualDetail::adlBegin(comparable2));
+
+        //Chunk i runs from chunkStarts[i] up to chunkStarts[i + 1], the last one is capped by the ends of the maps
+        std::pmr::vector<std::pair<Iterator1, Iterator2>> chunkStarts(options.resource());
+        chunkStarts.reserve((elementCount + chunkSize - 1) / chunkSize + 1);
+
+        Iterator1 comparable1Iter = isEqualDetail::adlBegin(comparable1);
+        Iterator2 comparable2Iter = isEqualDetail::adlBegin(comparable2);
+
+        for(std::size_t index = 0; index < elementCount; ++index, ++comparable1Iter, ++comparable2Iter){
+
+            if(index % chunkSize == 0){
+
+                chunkStarts.emplace_back(comparable1Iter, comparable2Iter);
+
+            }
+
+        }
+
+        chunkStarts.emplace_back(comparable1Iter, comparable2Iter);
+
+        return isEqualDetail::runChunksInParallel(chunkStarts.size() - 1, threadCount, options.resource(), [&](std::size_t chunkIndex){
+
+            Iterator2 chunk2Iter = chunkStarts[chunkIndex].second;
+
+            for(Iterator1 chunk1Iter = chunkStarts[chunkIndex].first; chunk1Iter != chunkStarts[chunkIndex + 1].first; ++chunk1Iter, ++chunk2Iter){
+
+                if(!isEqual(*chunk1Iter, *chunk2Iter, policy)){
+
+                    return false;
+
+                }
+
+            }
+
+            return true;
+
+        });
+
+    }
+    else if constexpr(is_iterable<Comparable1>::value && is_iterable<Comparable2>::value && !isEqualDetail::is_string_pair<Comparable1, Comparable2>::value &&
+                      isEqualDetail::is_random_access_iterable<Comparable1>::value && isEqualDetail::is_random_access_iterable<Comparable2>::value){
+
+        std::size_t elementCount = isEqualDetail::adlSize(comparable1);
+
+        if(elementCount != static_cast<std::size_t>(isEqualDetail::adlSize(comparable2))){
+
+            return false;
+
+        }
+
+        if(threadCount <= 1 || elementCount < options.minimumElements){
+
+            return isEqual(comparable1, comparable2, policy);
+
+        }
+
+        return isEqualDetail::runChunksInParallel((elementCount + chunkSize - 1) / chunkSize, threadCount, options.resource(), [&](std::size_t chunkIndex){
+
+            std::size_t chunkBegin = chunkIndex * chunkSize;
+            std::size_t chunkEnd   = std::min(elementCount, chunkBegin + chunkSize);
+
+            if constexpr((is_contiguous_arithmetic<Comparable1>::value && is_contiguous_arithmetic<Comparable2>::value) ||
+                         isEqualDetail::is_bitwise_comparable_range<Comparable1, Comparable2>::value){
+
+                return isEqualDetail::compareContiguousRange(isEqualDetail::adlData(comparable1) + chunkBegin,
+                                                             isEqualDetail::adlData(comparable2) + chunkBegin,
+                                                             chunkEnd - chunkBegin,
+                                                             policy);
+
+            }
+            else if constexpr(isEqualDetail::is_flattenable_range_pair<Comparable1, Comparable2>::value){
+
+                //A chunk of point cloud points is still one flat run of numbers, the same as the whole thing is for isEqual
+                using Element1 = std::remove_reference_t<decltype(*isEqualDetail::adlData(comparable1))>;
+                using Element2 = std::remove_reference_t<decltype(*isEqualDetail::adlData(comparable2))>;
+
+                return isEqualDetail::compareFlattened(ArrayView<Element1>(isEqualDetail::adlData(comparable1) + chunkBegin, chunkEnd - chunkBegin),
+                                                       ArrayView<Element2>(isEqualDetail::adlData(comparable2) + chunkBegin, chunkEnd - chunkBegin),
+                                                       policy);
+
+            }
+            else if constexpr(isEqualDetail::is_reduced_range_pair<Comparable1, Comparable2>::value){
+
+                return isEqualDetail::compareReducedRange(comparable1, comparable2, chunkBegin, chunkEnd, policy);
+
+            }
+            else{
+
+                auto comparable1Iter = isEqualDetail::adlBegin(comparable1) + chunkBegin;
+                auto comparable2Iter = isEqualDetail::adlBegin(comparable2) + chunkBegin;
+
+                for(std::size_t index = chunkBegin; index < chunkEnd; ++index, ++comparable1Iter, ++comparable2Iter){
+
+                    if(!isEqual(*comparable1Iter, *comparable2Iter, policy)){
+
+                        return false;
+
+                    }
+
+                }
+
+                return true;
+
+            }
+
+        });
+
+    }
+    else{
+
+        (void) threadCount;
+        (void) chunkSize;
+
+        return isEqual(comparable1, comparable2, policy);
+
+    }
+
+}
+
+struct FastRejectOptions{
+
+    std::size_t minimumElements  = 1 << 16;   //anything smaller just gets the full comparison, the probes take about a microsecond
+    std::size_t endpointElements = 64;        //how many elements the first block and the last block each hold
+    std::size_t samples          = 64;        //how many interior positions get probed
+    std::size_t sampleElements   = 8;         //how many elements each interior probe covers (random access only, elsewhere it's one)
+
+};
+
+namespace isEqualDetail{
+
+    template <typename Iterable, typename = void>
+    struct is_bidirectional_iterable : std::false_type {};
+
+    template <typename Iterable>
+    struct is_bidirectional_iterable<Iterable, std::void_t<iterator_category_of<Iterable>>>
+        : std::is_base_of<std::bidirectional_iterator_tag, iterator_category_of<Iterable>> {};
+
+    //Elements that cost about as much to compare as to step over, which makes a sampling walk over them no cheaper than the real thing
+    template <typename T>
+    struct is_cheap_to_compare : std::is_arithmetic<T> {};
+
+    template <typename Key, typename Value>
+    struct is_cheap_to_compare<std::pair<Key, Value>> : std::bool_constant<std::is_arithmetic_v<std::remove_cv_t<Key>> && std::is_arithmetic_v<Value>> {};
+
+    //Where the sample-th interior probe goes in a span of positions, spread by the golden ratio (as a 64 bit fixed point fraction)
+    //so the probes never line up with whatever period the data might have, and land in the same places on every run
+    inline std::size_t sampleOffset(std::size_t sample, std::size_t span){
+
+        std::uint64_t fraction = static_cast<std::uint64_t>(sample + 1) * 0x9E3779B97F4A7C15ull;
+
+        return static_cast<std::size_t>(((fraction >> 32) * static_cast<std::uint64_t>(span)) >> 32);
+
+    }
+
+    //[first, first + count) of two random access iterables, through whichever fast path isEqual would have picked for contiguous ones.
+    //Short blocks (the interior samples) skip that dispatch, which costs more than the handful of elements in them.
+    template <typename Comparable1, typename Comparable2, typename Tolerance>
+    bool compareRandomAccessBlock(const Comparable1& comparable1, const Comparable2& comparable2, std::size_t first, std::size_t count, const Tolerance& tolerance){
+
+        if constexpr(is_contiguous<Comparable1>::value && is_contiguous<Comparable2>::value){
+
+            if(count >= 32){
+
+                return isEqual(makeArrayView(adlData(comparable1) + first, count), makeArrayView(adlData(comparable2) + first, count), tolerance);
+
+            }
+
+        }
+
+        auto comparable1Iter = adlBegin(comparable1) + first;
+        auto comparable2Iter = adlBegin(comparable2) + first;
+
+        for(std::size_t index = 0; index < count; ++index, ++comparable1Iter, ++comparable2Iter){
+
+            if(!isEqual(*comparable1Iter, *comparable2Iter, tolerance)){
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    //The same, walking count pairs forward from two iterators
+    template <typename Iterator1, typename Iterator2, typename Tolerance>
+    bool compareWalkedBlock(Iterator1 iter1, Iterator2 iter2, std::size_t count, const Tolerance& tolerance){
+
+        for(std::size_t index = 0; index < count; ++index, ++iter1, ++iter2){
+
+            if(!isEqual(*iter1, *iter2, tolerance)){
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    /*
+     * The probes themselves, false only when one of them has actually found a pair of elements that isn't equal, which the full
+     * comparison would have tripped over too. Random access iterables get the first and the last block and then samples blocks
+     * spread over the interior. Everything else (maps, sets, lists...) gets the first block, the last one when it can be walked
+     * backwards, and then every n-th pair in one walk over the interior. That last walk only happens when the elements cost more
+     * to compare than stepping over them does (a std::map<int, std::vector<double>> yes, a std::list<double> or std::map<int, double> no).
+     */
+    template <typename Comparable1, typename Comparable2, typename Tolerance>
+    bool probeForMismatch(const Comparable1& comparable1, const Comparable2& comparable2, std::size_t elementCount, const Tolerance& tolerance,
+                          const FastRejectOptions& options){
+
+        std::size_t edge     = std::min(options.endpointElements, elementCount / 2);
+        std::size_t interior = elementCount - 2 * edge;
+
+        if constexpr(is_random_access_iterable<Comparable1>::value && is_random_access_iterable<Comparable2>::value){
+
+            if(!compareRandomAccessBlock(comparable1, comparable2, 0, edge, tolerance) ||
+               !compareRandomAccessBlock(comparable1, comparable2, elementCount - edge, edge, tolerance)){
+
+                return false;
+
+            }
+
+            std::size_t width = std::min(std::max<std::size_t>(1, options.sampleElements), interior);
+
+            for(std::size_t sample = 0; width && sample < options.samples; ++sample){
+
+                if(!compareRandomAccessBlock(comparable1, comparable2, edge + sampleOffset(sample, interior - width + 1), width, tolerance)){
+
+                    return false;
+
+                }
+
+            }
+
+            return true;
+
+        }
+        else{
+
+            if(!compareWalkedBlock(adlBegin(comparable1), adlBegin(comparable2), edge, tolerance)){
+
+                return false;
+
+            }
+
+            if constexpr(is_bidirectional_iterable<Comparable1>::value && is_bidirectional_iterable<Comparable2>::value){
+
+                if(!compareWalkedBlock(std::prev(adlEnd(comparable1), edge), std::prev(adlEnd(comparable2), edge), edge, tolerance)){
+
+                    return false;
+
+                }
+
+            }
+
+            using Element1 = std::remove_cv_t<std::remove_reference_t<decltype(*adlBegin(comparable1))>>;
+            using Element2 = std::remove_cv_t<std::remove_reference_t<decltype(*adlBegin(comparable2))>>;
+
+            if constexpr(!is_cheap_to_compare<Element1>::value || !is_cheap_to_compare<Element2>::value){
+
+                std::size_t stride = std::max<std::size_t>(1, interior / std::max<std::size_t>(1, options.samples));
+
+                auto comparable1Iter = std::next(adlBegin(comparable1), edge);
+                auto comparable2Iter = std::next(adlBegin(comparable2), edge);
+
+                for(std::size_t position = 0; position < interior; position += stride){
+
+                    if(!isEqual(*comparable1Iter, *comparable2Iter, tolerance)){
+
+                        return false;
+
+                    }
+
+                    if(interior - position > stride){
+
+                        std::advance(comparable1Iter, stride);
+                        std::advance(comparable2Iter, stride);
+
+                    }
+
+                }
+
+            }
+
+            return true;
+
+        }
+
+    }
+
+} //namespace isEqualDetail
+
+/*
+ * Same answers as isEqual, but for two mismatching containers that differ all over (or only towards the end) it finds out
+ * without walking up to the first difference: sizes first, then the first and the last few elements, then a fixed sample
+ * of positions in between, and only once none of those has found anything the usual full comparison. Every probe is just
+ * isEqual on a pair of elements that the full comparison would line up the same way, so a probe can only say no when the
+ * full comparison would have too, and whatever passes every probe gets the full comparison's answer. That covers
+ * iterables and ordered maps and sets. Hashed containers are compared by lookup rather than by position, and strings are a
+ * single memcmp already, so those (and anything else, or anything smaller than options.minimumElements) simply go to isEqual. Only the top level gets probed,
+ * the elements of a std::map<int, std::vector<double>> are compared as a whole.
+ */
+template <typename Comparable1, typename Comparable2, typename Tolerance = AbsoluteTolerance>
+inline bool isEqualFastReject(const Comparable1& comparable1, const Comparable2& comparable2, const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE),
+                              const FastRejectOptions& options = FastRejectOptions()){
+
+    //Converted once up front, rather than by every probe
+    const auto policy = isEqualDetail::toTolerancePolicy(tolerance);
+
+    if constexpr(is_iterable<Comparable1>::value && is_iterable<Comparable2>::value && !isEqualDetail::is_lookup_comparable<Comparable1, Comparable2>::value &&
+                 !isEqualDetail::is_string_pair<Comparable1, Comparable2>::value){
+
+        std::size_t elementCount = isEqualDetail::adlSize(comparable1);
+
+        if(elementCount != static_cast<std::size_t>(isEqualDetail::adlSize(comparable2))){
+
+            return false;
+
+        }
+
+        if(elementCount >= options.minimumElements && !isEqualDetail::probeForMismatch(comparable1, comparable2, elementCount, policy, options)){
+
+            return false;
+
+        }
+
+        return isEqual(comparable1, comparable2, policy);
+
+    }
+    else{
+
+        (void) options;
+
+        return isEqual(comparable1, comparable2, policy);
+
+    }
+
+}
+
+/*
+ * The answers of a batch comparison, one bit per candidate (or pair), set when it's equal. They're packed 64 to a word,
+ * so 10k results take 1.25 KiB and whole words can be handed around, or checked for all/none, at once. The words live in
+ * ParallelOptions::memoryResource when the batch functions build one.
+ */
+class BatchResult{
+
+public:
+
+    BatchResult() = default;
+
+    explicit BatchResult(std::size_t countIn, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : count(countIn),
+          words((countIn + 63) / 64, 0, resource){
+
+        /* NOP */
+
+    }
+
+    std::size_t                            size()                        const{ return count;                                   }
+    bool                                   operator[](std::size_t index) const{ return (words[index / 64] >> (index % 64)) & 1; }
+    std::uint64_t                          word(std::size_t wordIndex)   const{ return words[wordIndex];                        }
+    const std::pmr::vector<std::uint64_t>& data()                        const{ return words;                                   }
+
+    void set(std::size_t index, bool isEqualIn){
+
+        std::uint64_t bit = std::uint64_t(1) << (index % 64);
+
+        words[index / 64] = isEqualIn ? (words[index / 64] | bit) : (words[index / 64] & ~bit);
+
+    }
+
+    //Only ever called with bits past size() cleared, so the counts below never have to mask the last word
+    void setWord(std::size_t wordIndex, std::uint64_t bits){
+
+        words[wordIndex] = bits;
+
+    }
+
+    std::size_t equalCount() const{
+
+        std::size_t equal = 0;
+
+        for(std::uint64_t bits : words){
+
+            for(; bits; bits &= bits - 1){
+
+                ++equal;
+
+            }
+
+        }
+
+        return equal;
+
+    }
+
+    bool all()  const{ return equalCount() == count; }
+    bool none() const{ return equalCount() == 0;     }
+
+private:
+
+    std::size_t                     count = 0;
+    std::pmr::vector<std::uint64_t> words;
+
+};
+
+namespace isEqualDetail{
+
+    //Candidates get handed out one BatchResult word (64 of them) at a time, so no two workers ever write to the same word
+    constexpr std::size_t batchGroupSize = 64;
+
+    //Roughly how many elements one comparison touches, which is what ParallelOptions::minimumElements gets weighed against
+    template <typename Comparable>
+    std::size_t batchElementCount(const Comparable& comparable){
+
+        if constexpr(is_iterable<Comparable>::value){
+
+            return static_cast<std::size_t>(adlSize(comparable));
+
+        }
+        else{
+
+            (void) comparable;
+            return 1;
+
+        }
+
+    }
+
+    //Fills in every word of result with compareGroup(groupIndex), spread across threads once there's enough work for it
+    template <typename CompareGroup>
+    void runBatchGroups(BatchResult& result, std::size_t totalElements, const ParallelOptions& options, const CompareGroup& compareGroup){
+
+        std::size_t groupCount  = (result.size() + batchGroupSize - 1) / batchGroupSize;
+        std::size_t threadCount = options.threadCount ? options.threadCount : std::max(1u, std::thread::hardware_concurrency());
+
+        if(threadCount <= 1 || groupCount <= 1 || totalElements < options.minimumElements){
+
+            for(std::size_t groupIndex = 0; groupIndex < groupCount; ++groupIndex){
+
+                result.setWord(groupIndex, compareGroup(groupIndex));
+
+            }
+
+            return;
+
+        }
+
+        //A group coming back unequal is an answer like any other here, so nothing ever gets cancelled
+        runChunksInParallel(groupCount, threadCount, options.resource(), [&](std::size_t groupIndex){
+
+            result.setWord(groupIndex, compareGroup(groupIndex));
+            return true;
+
+        });
+
+    }
+
+    /*
+     * One group of up to 64 contiguous candidates against a contiguous reference, a tile of the reference at a time: each tile gets
+     * compared against every candidate still standing before moving on, so it's read from memory once per group instead of once per
+     * candidate. Candidates drop out of the group as soon as they differ (or right away, on a size mismatch).
+     */
+    template <typename Reference, typename Candidates, typename Tolerance>
+    std::uint64_t compareBatchGroupTiled(const Reference& reference, const Candidates& candidates, std::size_t groupBegin, std::size_t groupEnd,
+                                         std::size_t tileElements, const Tolerance& tolerance){
+
+        std::size_t   referenceSize = static_cast<std::size_t>(adlSize(reference));
+        auto          candidateIter = adlBegin(candidates) + groupBegin;
+        std::uint64_t standing      = 0;
+
+        for(std::size_t lane = 0; lane < groupEnd - groupBegin; ++lane){
+
+            if(static_cast<std::size_t>(adlSize(candidateIter[lane])) == referenceSize){
+
+                standing |= std::uint64_t(1) << lane;
+
+            }
+
+        }
+
+        for(std::size_t tileBegin = 0; tileBegin < referenceSize && standing; tileBegin += tileElements){
+
+            std::size_t tileCount = std::min(tileElements, referenceSize - tileBegin);
+
+            for(std::size_t lane = 0; lane < groupEnd - groupBegin; ++lane){
+
+                if(((standing >> lane) & 1) &&
+                   !compareContiguousRange(adlData(reference) + tileBegin, adlData(candidateIter[lane]) + tileBegin, tileCount, tolerance)){
+
+                    standing &= ~(std::uint64_t(1) << lane);
+
+                }
+
+            }
+
+        }
+
+        return standing;
+
+    }
+
+} //namespace isEqualDetail
+
+/*
+ * One reference against a whole range of candidates, bit i of the result being isEqual(reference, candidates[i], tolerance).
+ * On top of what calling isEqual in a loop would do:
+ *  - the tolerance gets turned into its policy, and the branch every candidate will take picked, once for the whole batch
+ *  - contiguous arithmetic references (std::vector<double> and friends) against contiguous candidates get compared a tile of
+ *    options.chunkElements at a time across 64 candidates at once, so the reference streams from memory once per 64 candidates
+ *    instead of once per candidate, which is what keeps a 10k candidate batch from being bound by memory bandwidth
+ *  - groups of 64 candidates get spread across options.threadCount threads, once the batch touches options.minimumElements
+ *    elements in total; candidate ranges that aren't random access (a std::list of vectors...) just run on the calling thread
+ */
+template <typename Reference, typename Candidates, typename Tolerance = AbsoluteTolerance>
+inline BatchResult isEqualBatch(const Reference& reference, const Candidates& candidates, const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE),
+                                const ParallelOptions& options = ParallelOptions()){
+
+    using Candidate = isEqualDetail::range_element_t<Candidates>;
+
+    const auto policy = isEqualDetail::toTolerancePolicy(tolerance);
+
+    std::size_t candidateCount = static_cast<std::size_t>(isEqualDetail::adlSize(candidates));
+    BatchResult result(candidateCount, options.resource());
+
+    if constexpr(isEqualDetail::is_random_access_iterable<Candidates>::value){
+
+        std::size_t totalElements = candidateCount * isEqualDetail::batchElementCount(reference);
+
+        if constexpr(((is_contiguous_arithmetic<Reference>::value && is_contiguous_arithmetic<Candidate>::value) ||
+                      isEqualDetail::is_bitwise_comparable_range<Reference, Candidate>::value) && !isEqualDetail::is_string_pair<Reference, Candidate>::value){
+
+            std::size_t tileElements = std::max<std::size_t>(1, options.chunkElements);
+
+            isEqualDetail::runBatchGroups(result, totalElements, options, [&](std::size_t groupIndex){
+
+                std::size_t groupBegin = groupIndex * isEqualDetail::batchGroupSize;
+                std::size_t groupEnd   = std::min(candidateCount, groupBegin + isEqualDetail::batchGroupSize);
+
+                return isEqualDetail::compareBatchGroupTiled(reference, candidates, groupBegin, groupEnd, tileElements, policy);
+
+            });
+
+        }
+        else{
+
+            isEqualDetail::runBatchGroups(result, totalElements, options, [&](std::size_t groupIndex){
+
+                std::size_t   groupBegin    = groupIndex * isEqualDetail::batchGroupSize;
+                std::size_t   groupEnd      = std::min(candidateCount, groupBegin + isEqualDetail::batchGroupSize);
+                auto          candidateIter = isEqualDetail::adlBegin(candidates) + groupBegin;
+                std::uint64_t bits          = 0;
+
+                for(std::size_t lane = 0; lane < groupEnd - groupBegin; ++lane){
+
+                    bits |= std::uint64_t(isEqual(reference, candidateIter[lane], policy)) << lane;
+
+                }
+
+                return bits;
+
+            });
+
+        }
+
+    }
+    else{
+
+        (void) options;
+
+        std::size_t index = 0;
+
+        for(auto candidateIter = isEqualDetail::adlBegin(candidates); candidateIter != isEqualDetail::adlEnd(candidates); ++candidateIter, ++index){
+
+            result.set(index, isEqual(reference, *candidateIter, policy));
+
+        }
+
+    }
+
+    return result;
+
+}
+
+/*
+ * N independent pairs, bit i of the result being isEqual(range1[i], range2[i], tolerance). Spread across threads 64 pairs at a time
+ * when both ranges are random access, walked in lockstep on the calling thread otherwise. If one range is longer than the other,
+ * the result is as long as the longer one and the pairs missing a side come out unequal.
+ */
+template <typename Range1, typename Range2, typename Tolerance = AbsoluteTolerance>
+inline BatchResult isEqualBatchPairs(const Range1& range1, const Range2& range2, const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE),
+                                     const ParallelOptions& options = ParallelOptions()){
+
+    const auto policy = isEqualDetail::toTolerancePolicy(tolerance);
+
+    std::size_t size1     = static_cast<std::size_t>(isEqualDetail::adlSize(range1));
+    std::size_t size2     = static_cast<std::size_t>(isEqualDetail::adlSize(range2));
+    std::size_t pairCount = std::min(size1, size2);
+    BatchResult result(std::max(size1, size2), options.resource());
+
+    if constexpr(isEqualDetail::is_random_access_iterable<Range1>::value && isEqualDetail::is_random_access_iterable<Range2>::value){
+
+        std::size_t totalElements = 0;
+
+        for(std::size_t index = 0; index < pairCount; ++index){
+
+            totalElements += isEqualDetail::batchElementCount(isEqualDetail::adlBegin(range1)[index]);
+
+        }
+
+        isEqualDetail::runBatchGroups(result, totalElements, options, [&](std::size_t groupIndex){
+
+            std::size_t   groupBegin = groupIndex * isEqualDetail::batchGroupSize;
+            std::uint64_t bits       = 0;
+
+            //The groups past the shorter range have no pairs at all, and stay all unequal
+            for(std::size_t index = groupBegin; index < std::min(pairCount, groupBegin + isEqualDetail::batchGroupSize); ++index){
+
+                bits |= std::uint64_t(isEqual(isEqualDetail::adlBegin(range1)[index], isEqualDetail::adlBegin(range2)[index], policy)) << (index - groupBegin);
+
+            }
+
+            return bits;
+
+        });
+
+    }
+    else{
+
+        (void) options;
+
+        auto range1Iter = isEqualDetail::adlBegin(range1);
+        auto range2Iter = isEqualDetail::adlBegin(range2);
+
+        for(std::size_t index = 0; index < pairCount; ++index, ++range1Iter, ++range2Iter){
+
+            result.set(index, isEqual(*range1Iter, *range2Iter, policy));
+
+        }
+
+    }
+
+    return result;
+
+}
+
+#endif //ISEQUAL_H
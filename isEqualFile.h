@@ -0,0 +1,425 @@
+/* MIT License
+ *
+ * Copyright (c) 2020 B1anky
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#ifndef ISEQUALFILE_H
+#define ISEQUALFILE_H
+
+/*
+ * isEqual for two binary files full of numbers, i.e. a golden simulation dump against a candidate one. Both files get mmapped and
+ * walked one window at a time, so nothing ever gets read into a std::vector and memory use stays at a couple of windows worth of
+ * page cache no matter how big the files are (pages behind the cursor get handed back as we go). POSIX only, since it's built on
+ * mmap and madvise.
+ *
+ *     FileCompareResult result = isEqualFiles<float, double>("golden.f32", "candidate.f64", 1E-5);
+ *
+ * or, when the element types are only known at run time (see compareFiles.cpp for a CLI around this):
+ *
+ *     FileCompareResult result = isEqualFiles("golden.bin", FileElementType::F32, "candidate.bin", FileElementType::F64, AbsoluteTolerance(1E-5));
+ *
+ * The files are read in the machine's own byte order.
+ */
+
+#include "isEqual.h"
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//Every element type a file can hold
+enum class FileElementType{ F32, F64, I8, I16, I32, I64, U8, U16, U32, U64 };
+
+struct FileCompareOptions{
+
+    std::size_t offset1     = 0;                            //bytes to skip at the start of the first file (a header, say) before its elements begin
+    std::size_t offset2     = 0;                            //same for the second file
+    std::size_t maxElements = 0;                            //only compare this many elements, 0 means all of them
+    std::size_t windowBytes = std::size_t(64) << 20;        //how much of the first file gets compared per window, at least one element's worth
+
+};
+
+struct FileCompareResult{
+
+    bool          equal            = false;
+    std::string   error;                                    //set when a file couldn't be opened or mapped, its offset is past its end or the window is too small
+    std::uint64_t elementCount1    = 0;                     //elements after the offset, in each file
+    std::uint64_t elementCount2    = 0;
+    std::uint64_t elementsCompared = 0;
+    bool          hasMismatch      = false;                 //false for equal files, errors and element counts that differ
+    std::uint64_t mismatchIndex    = 0;                     //index of the first element that differs
+    std::uint64_t mismatchOffset1  = 0;                     //and where it sits in each file, in bytes from the very start
+    std::uint64_t mismatchOffset2  = 0;
+    std::string   value1;                                   //both values, printed with enough digits to round trip
+    std::string   value2;
+
+};
+
+namespace isEqualDetail{
+
+    //A read only, whole file mapping that can hand pages it has already been through back to the kernel
+    class MappedFile{
+
+    public:
+
+        explicit MappedFile(const std::string& path)
+            : mapping(nullptr),
+              length(0),
+              released(0){
+
+            int descriptor = ::open(path.c_str(), O_RDONLY);
+
+            if(descriptor < 0){
+
+                error = path + ": " + std::strerror(errno);
+                return;
+
+            }
+
+            struct stat status;
+
+            if(::fstat(descriptor, &status) != 0){
+
+                error = path + ": " + std::strerror(errno);
+
+            }
+            else if(status.st_size > 0){
+
+                length  = static_cast<std::size_t>(status.st_size);
+                mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+                if(mapping == MAP_FAILED){
+
+                    error   = path + ": " + std::strerror(errno);
+                    mapping = nullptr;
+                    length  = 0;
+
+                }
+                else{
+
+                    //Doubles the kernel's read-ahead, and lets it drop pages once we're past them
+                    ::madvise(mapping, length, MADV_SEQUENTIAL);
+
+                }
+
+            }
+
+            //The mapping keeps the file alive on its own
+            ::close(descriptor);
+
+        }
+
+        MappedFile(const MappedFile&)            = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile(){
+
+            if(mapping){
+
+                ::munmap(mapping, length);
+
+            }
+
+        }
+
+        const unsigned char* data() const{
+
+            return static_cast<const unsigned char*>(mapping);
+
+        }
+
+        std::size_t size() const{
+
+            return length;
+
+        }
+
+        //Everything before byteOffset is done with, so its (whole) pages can go
+        void releaseBefore(std::size_t byteOffset){
+
+            static const std::size_t pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+            std::size_t releaseEnd = std::min(byteOffset, length) / pageSize * pageSize;
+
+            if(mapping && releaseEnd > released){
+
+                ::madvise(static_cast<unsigned char*>(mapping) + released, releaseEnd - released, MADV_DONTNEED);
+                released = releaseEnd;
+
+            }
+
+        }
+
+    public:
+
+        std::string error;
+
+    private:
+
+        void*       mapping;
+        std::size_t length;
+        std::size_t released;
+
+    };
+
+    //How many elements are staged at a time when a file's elements don't sit at an address their type can be read from
+    constexpr std::size_t unalignedBlockElements = 4096;
+
+    //A run of elements from a mapping, handed to isEqual as an ArrayView straight out of the page cache whenever the offset
+    //leaves them aligned, and otherwise copied a block at a time into a small aligned buffer first
+    template <typename Element1, typename Element2, typename Tolerance>
+    inline bool compareMappedRun(const unsigned char* bytes1, const unsigned char* bytes2, std::size_t count, const Tolerance& tolerance){
+
+        bool aligned1 = reinterpret_cast<std::uintptr_t>(bytes1) % alignof(Element1) == 0;
+        bool aligned2 = reinterpret_cast<std::uintptr_t>(bytes2) % alignof(Element2) == 0;
+
+        if(aligned1 && aligned2){
+
+            return isEqual(makeArrayView(reinterpret_cast<const Element1*>(bytes1), count),
+                           makeArrayView(reinterpret_cast<const Element2*>(bytes2), count), tolerance);
+
+        }
+
+        Element1 block1[unalignedBlockElements];
+        Element2 block2[unalignedBlockElements];
+
+        for(std::size_t done = 0; done < count; done += unalignedBlockElements){
+
+            std::size_t blockCount = std::min(unalignedBlockElements, count - done);
+
+            std::memcpy(block1, bytes1 + done * sizeof(Element1), blockCount * sizeof(Element1));
+            std::memcpy(block2, bytes2 + done * sizeof(Element2), blockCount * sizeof(Element2));
+
+            if(!isEqual(makeArrayView(static_cast<const Element1*>(block1), blockCount),
+                        makeArrayView(static_cast<const Element2*>(block2), blockCount), tolerance)){
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    template <typename Element>
+    inline Element loadElement(const unsigned char* bytes){
+
+        Element element;
+        std::memcpy(&element, bytes, sizeof(Element));
+
+        return element;
+
+    }
+
+    template <typename T>
+    struct TypeTag{
+
+        using type = T;
+
+    };
+
+    //Calls visitor with a TypeTag of whatever type the enum names
+    template <typename Visitor>
+    inline decltype(auto) visitFileElementType(FileElementType elementType, Visitor&& visitor){
+
+        switch(elementType){
+            case FileElementType::F32: return visitor(TypeTag<float>());
+            case FileElementType::F64: return visitor(TypeTag<double>());
+            case FileElementType::I8:  return visitor(TypeTag<std::int8_t>());
+            case FileElementType::I16: return visitor(TypeTag<std::int16_t>());
+            case FileElementType::I32: return visitor(TypeTag<std::int32_t>());
+            case FileElementType::I64: return visitor(TypeTag<std::int64_t>());
+            case FileElementType::U8:  return visitor(TypeTag<std::uint8_t>());
+            case FileElementType::U16: return visitor(TypeTag<std::uint16_t>());
+            case FileElementType::U32: return visitor(TypeTag<std::uint32_t>());
+            default:                   return visitor(TypeTag<std::uint64_t>());
+        }
+
+    }
+
+} //namespace isEqualDetail
+
+//"f32", "f64", "i8" ... "u64", for command lines and config files. Returns false (and leaves elementType alone) for anything else.
+inline bool parseFileElementType(const std::string& name, FileElementType& elementType){
+
+    static const std::pair<const char*, FileElementType> names[] = {
+        {"f32", FileElementType::F32}, {"f64", FileElementType::F64},
+        {"i8",  FileElementType::I8},  {"i16", FileElementType::I16}, {"i32", FileElementType::I32}, {"i64", FileElementType::I64},
+        {"u8",  FileElementType::U8},  {"u16", FileElementType::U16}, {"u32", FileElementType::U32}, {"u64", FileElementType::U64}
+    };
+
+    for(const auto& entry : names){
+
+        if(name == entry.first){
+
+            elementType = entry.second;
+            return true;
+
+        }
+
+    }
+
+    return false;
+
+}
+
+/*
+ * Compares the elements of two files as arrays of Element1 and Element2, window by window, with the same answers isEqual would give
+ * for two std::vectors holding them. Stops at the first element that differs and says where it is. Element counts that differ
+ * (after the offsets) make the files unequal without comparing anything, just like differing sizes do for containers, unless
+ * options.maxElements is set and both files have at least that many.
+ */
+template <typename Element1, typename Element2, typename Tolerance = AbsoluteTolerance>
+inline FileCompareResult isEqualFiles(const std::string& path1, const std::string& path2, const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE),
+                                      const FileCompareOptions& options = FileCompareOptions()){
+
+    static_assert(std::is_arithmetic_v<Element1> && std::is_arithmetic_v<Element2>, "files can only be compared as arrays of numbers");
+
+    FileCompareResult result;
+
+    isEqualDetail::MappedFile file1(path1);
+    isEqualDetail::MappedFile file2(path2);
+
+    if(!file1.error.empty() || !file2.error.empty()){
+
+        result.error = !file1.error.empty() ? file1.error : file2.error;
+        return result;
+
+    }
+
+    if(options.offset1 > file1.size() || options.offset2 > file2.size()){
+
+        result.error = options.offset1 > file1.size() ? path1 + ": offset is past the end of the file" : path2 + ": offset is past the end of the file";
+        return result;
+
+    }
+
+    if(options.windowBytes < sizeof(Element1)){
+
+        result.error = "a window of " + std::to_string(options.windowBytes) + " bytes can't hold a single element";
+        return result;
+
+    }
+
+    result.elementCount1 = (file1.size() - options.offset1) / sizeof(Element1);
+    result.elementCount2 = (file2.size() - options.offset2) / sizeof(Element2);
+
+    std::uint64_t elementCount = std::min(result.elementCount1, result.elementCount2);
+
+    if(options.maxElements){
+
+        elementCount = std::min<std::uint64_t>(elementCount, options.maxElements);
+
+        if(elementCount < options.maxElements && result.elementCount1 != result.elementCount2){
+
+            return result;
+
+        }
+
+    }
+    else if(result.elementCount1 != result.elementCount2){
+
+        return result;
+
+    }
+
+    const auto          policy         = isEqualDetail::toTolerancePolicy(tolerance);
+    const std::size_t   windowElements = options.windowBytes / sizeof(Element1);
+    const unsigned char* bytes1        = file1.data() + options.offset1;
+    const unsigned char* bytes2        = file2.data() + options.offset2;
+
+    for(std::uint64_t windowStart = 0; windowStart < elementCount; windowStart += windowElements){
+
+        std::size_t windowCount = static_cast<std::size_t>(std::min<std::uint64_t>(windowElements, elementCount - windowStart));
+
+        const unsigned char* window1 = bytes1 + windowStart * sizeof(Element1);
+        const unsigned char* window2 = bytes2 + windowStart * sizeof(Element2);
+
+        if(!isEqualDetail::compareMappedRun<Element1, Element2>(window1, window2, windowCount, policy)){
+
+            //The window only says yes or no, so go back over it one element at a time to find the first one that differs
+            for(std::size_t index = 0; index < windowCount; ++index){
+
+                Element1 element1 = isEqualDetail::loadElement<Element1>(window1 + index * sizeof(Element1));
+                Element2 element2 = isEqualDetail::loadElement<Element2>(window2 + index * sizeof(Element2));
+
+                if(!isEqualDetail::isWithinTolerance(element1, element2, policy)){
+
+                    result.hasMismatch     = true;
+                    result.mismatchIndex   = windowStart + index;
+                    result.mismatchOffset1 = options.offset1 + result.mismatchIndex * sizeof(Element1);
+                    result.mismatchOffset2 = options.offset2 + result.mismatchIndex * sizeof(Element2);
+                    result.value1          = isEqualDetail::describeValue(element1);
+                    result.value2          = isEqualDetail::describeValue(element2);
+                    break;
+
+                }
+
+            }
+
+            result.elementsCompared = result.mismatchIndex + 1;
+            return result;
+
+        }
+
+        result.elementsCompared = windowStart + windowCount;
+
+        file1.releaseBefore(options.offset1 + result.elementsCompared * sizeof(Element1));
+        file2.releaseBefore(options.offset2 + result.elementsCompared * sizeof(Element2));
+
+    }
+
+    result.equal = true;
+
+    return result;
+
+}
+
+//The same, with both element types picked at run time
+template <typename Tolerance = AbsoluteTolerance>
+inline FileCompareResult isEqualFiles(const std::string& path1, FileElementType elementType1, const std::string& path2, FileElementType elementType2,
+                                      const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE), const FileCompareOptions& options = FileCompareOptions()){
+
+    return isEqualDetail::visitFileElementType(elementType1, [&](auto elementTag1){
+
+        return isEqualDetail::visitFileElementType(elementType2, [&](auto elementTag2){
+
+            return isEqualFiles<typename decltype(elementTag1)::type, typename decltype(elementTag2)::type>(path1, path2, tolerance, options);
+
+        });
+
+    });
+
+}
+
+#endif //ISEQUALFILE_H
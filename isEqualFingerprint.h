@@ -0,0 +1,425 @@
+/* MIT License
+ *
+ * Copyright (c) 2020 B1anky
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#ifndef ISEQUALFINGERPRINT_H
+#define ISEQUALFINGERPRINT_H
+
+/*
+ * Fingerprints, for when the same big reference (a std::map<int, std::vector<double>>, a tuple of vectors...) gets compared against
+ * thousands of candidates. A Fingerprint is a fixed size digest built with the same type dispatch isEqual uses, holding the shape of
+ * the thing (every container's size, all the way down) and a few tolerance independent numbers about its leaves: how many there are,
+ * their sum, their smallest and largest values and a hash of the integer ones. Wrap an object in a Fingerprinted and its digest gets
+ * computed once and kept up to date as elements get appended.
+ *
+ * mayBeEqual(fingerprint1, fingerprint2, tolerance) is O(1), and answers one of two things:
+ *  - false means the two are definitely not equal. That answer is never wrong, for every tolerance policy: the checks it's built on
+ *    (matching shapes, leaf sums at most count * tolerance apart, minimums and maximums at most one tolerance apart, identical integers
+ *    when the tolerance can't let different ones through) all hold for any two equal objects, with room left over for rounding in
+ *    the sums. Hash collisions can only ever turn a false into a true, never the other way around.
+ *  - true only means the digests couldn't tell them apart, which says nothing about whether they're equal.
+ * isEqualFingerprinted therefore always falls back to the full isEqual whenever mayBeEqual says true, so its answer is exactly isEqual's.
+ * NaNs and infinities in the leaves make the numeric checks inconclusive (never a false), and leaves isEqual can only compare with
+ * operator== or isEqualMembers are counted in the shape but otherwise left to the full check. Strings are containers of their code units
+ * like everything else (which is what isEqual compares them as against a std::vector<int>), with a hash of them on top for when the
+ * other side is a string too.
+ */
+
+#include "isEqual.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+
+struct Fingerprint{
+
+    bool          isContainer   = false;   //containers, tuples and pairs; everything else is a single leaf
+    std::uint64_t size          = 0;       //elements directly inside a container
+    std::uint64_t elementShapes = 0;       //the elements' shapes, summed so any order (think unordered containers) adds up the same
+    std::uint64_t leafToken     = 0;       //which kind of leaf this is, when it is one
+
+    std::uint64_t leafCount     = 0;       //numeric leaves, all the way down
+    double        sum           = 0.0;
+    double        sumAbs        = 0.0;     //sum of |leaf|, which bounds the rounding error in sum
+    double        minimum       = std::numeric_limits<double>::infinity();
+    double        maximum       = -std::numeric_limits<double>::infinity();
+    std::uint64_t integerHash   = 0;       //the integer leaves, summed in the same order-free way as the shapes
+    bool          allIntegral   = true;    //whether every numeric leaf was an integer, which is what makes integerHash usable
+
+    bool          isString        = false; //strings are containers of their code units, plus this for when the other side is a string too
+    bool          containsStrings = false; //whether there's a string anywhere in here, this one included
+    std::uint64_t stringHash      = 0;     //a string's code units with A-Z folded, chained in order
+
+    //Folds one element's fingerprint into a container's
+    void add(const Fingerprint& element);
+
+    std::uint64_t shape() const;
+
+};
+
+namespace isEqualDetail{
+
+    //splitmix64's finalizer, plenty to spread the shapes and integers out before they get summed
+    constexpr std::uint64_t mixBits(std::uint64_t bits){
+
+        bits ^= bits >> 30;
+        bits *= 0xBF58476D1CE4E5B9ULL;
+        bits ^= bits >> 27;
+        bits *= 0x94D049BB133111EBULL;
+        bits ^= bits >> 31;
+
+        return bits;
+
+    }
+
+    constexpr std::uint64_t numericLeafToken = 0x6E756D65726963ULL;   //"numeric"
+    constexpr std::uint64_t nullLeafToken    = 0x6E756C6C707472ULL;   //"nullptr"
+    constexpr std::uint64_t opaqueLeafToken  = 0x6F7061717565ULL;     //"opaque"
+    constexpr std::uint64_t stringLeafToken  = 0x737472696E67ULL;     //"string"
+
+    //A string's code units as the numbers its leaves get fingerprinted as. std::byte isn't a number anywhere else, but inside a string
+    //it still has to line up with every other string's code units.
+    template <typename Unit>
+    constexpr auto codeUnitLeaf(Unit unit){
+
+        if constexpr(std::is_arithmetic_v<Unit>) return unit;
+        else                                     return codeUnitValue(unit);
+
+    }
+
+    template <typename Unit>
+    constexpr std::uint64_t foldIntoStringHash(std::uint64_t stringHash, Unit unit){
+
+        return mixBits(stringHash ^ asciiFold(codeUnitValue(unit)));
+
+    }
+
+} //namespace isEqualDetail
+
+inline void Fingerprint::add(const Fingerprint& element){
+
+    ++size;
+    elementShapes += isEqualDetail::mixBits(element.shape());
+
+    leafCount   += element.leafCount;
+    sum         += element.sum;
+    sumAbs      += element.sumAbs;
+    minimum      = std::min(minimum, element.minimum);
+    maximum      = std::max(maximum, element.maximum);
+    integerHash += element.integerHash;
+    allIntegral  = allIntegral && element.allIntegral;
+
+    containsStrings = containsStrings || element.containsStrings;
+
+}
+
+inline std::uint64_t Fingerprint::shape() const{
+
+    return isContainer ? isEqualDetail::mixBits(size * 0x9E3779B97F4A7C15ULL ^ elementShapes) : leafToken;
+
+}
+
+//Fingerprints anything isEqual can compare, walking it with the same branches isEqual would
+template <typename Comparable>
+inline Fingerprint makeFingerprint(const Comparable& comparable){
+
+    Fingerprint fingerprint;
+
+    //Strings are fingerprinted twice over. Against anything that isn't a string isEqual walks them as the numbers they hold, so they're
+    //containers of their code units like any other. Against another string it compares code units exactly (or with A-Z folded, when
+    //either side asked for asciiCaseInsensitive), which stringHash covers: it's the same for every pair of strings isEqual calls equal.
+    //A null char pointer hashes like nothing else.
+    if constexpr(isEqualDetail::string_traits<Comparable>::value){
+
+        using Traits = isEqualDetail::string_traits<Comparable>;
+
+        const auto* units  = Traits::data(comparable);
+        std::size_t length = Traits::length(comparable);
+
+        fingerprint.isContainer     = true;
+        fingerprint.isString        = true;
+        fingerprint.containsStrings = true;
+        fingerprint.stringHash      = isEqualDetail::mixBits(isEqualDetail::stringLeafToken ^ (Traits::isNull(comparable) ? ~0ULL : 0ULL));
+
+        for(std::size_t index = 0; index < length; ++index){
+
+            fingerprint.add(makeFingerprint(isEqualDetail::codeUnitLeaf(units[index])));
+            fingerprint.stringHash = isEqualDetail::foldIntoStringHash(fingerprint.stringHash, units[index]);
+
+        }
+
+    }
+    else if constexpr(is_map<Comparable>::value          || is_set<Comparable>::value           ||
+                 is_unordered_map<Comparable>::value || is_unordered_set<Comparable>::value ||
+                 is_iterable<Comparable>::value      || is_single_pass_iterable<Comparable>::value){
+
+        fingerprint.isContainer = true;
+
+        for(auto iter = isEqualDetail::adlBegin(comparable); iter != isEqualDetail::adlEnd(comparable); ++iter){
+
+            fingerprint.add(makeFingerprint(*iter));
+
+        }
+
+    }
+    else if constexpr(std::is_null_pointer_v<Comparable>){
+
+        fingerprint.leafToken = isEqualDetail::nullLeafToken;
+
+    }
+    else if constexpr(std::is_arithmetic_v<Comparable> || isEqualDetail::is_reduced_float<Comparable>::value){
+
+        //Halves and bfloat16s are numbers like any other here, isEqual compares them as the floats they widen to
+        double value = static_cast<double>(isEqualDetail::widenReduced(comparable));
+
+        fingerprint.leafToken = isEqualDetail::numericLeafToken;
+        fingerprint.leafCount = 1;
+        fingerprint.sum       = value;
+        fingerprint.sumAbs    = value < 0 ? -value : value;
+        fingerprint.minimum   = value;
+        fingerprint.maximum   = value;
+
+        if constexpr(std::is_integral_v<Comparable>){
+
+            fingerprint.integerHash = isEqualDetail::mixBits(static_cast<std::uint64_t>(comparable));
+
+        }
+        else{
+
+            fingerprint.allIntegral = false;
+
+        }
+
+    }
+    else if constexpr(is_pair<Comparable>::value || is_tuple<Comparable>::value){
+
+        fingerprint.isContainer = true;
+
+        std::apply([&fingerprint](const auto&... element){
+
+            (fingerprint.add(makeFingerprint(element)), ...);
+
+        }, comparable);
+
+    }
+    else{
+
+        //Whatever isEqual compares with isEqualMembers or operator==, only the full comparison knows what's inside
+        (void) comparable;
+        fingerprint.leafToken = isEqualDetail::opaqueLeafToken;
+
+    }
+
+    return fingerprint;
+
+}
+
+namespace isEqualDetail{
+
+    //The furthest apart two single leaves can be and still be equal under a policy, given every leaf of both sides sits within [minimum, maximum]
+    inline double leafBound(const ExactTolerance&, double){
+
+        return 0.0;
+
+    }
+
+    inline double leafBound(const AbsoluteTolerance& tolerance, double){
+
+        return tolerance.value;
+
+    }
+
+    inline double leafBound(const RelativeTolerance& tolerance, double largestMagnitude){
+
+        return tolerance.value * largestMagnitude;
+
+    }
+
+    //A float's ULP is the widest there is (and never wider than 1 below 1), integers count every integer as one
+    inline double leafBound(const UlpTolerance& tolerance, double largestMagnitude){
+
+        return static_cast<double>(tolerance.maxUlps) * std::max(1.0, largestMagnitude * std::numeric_limits<float>::epsilon());
+
+    }
+
+    inline double leafBound(const AbsRelTolerance& tolerance, double largestMagnitude){
+
+        return std::max(leafBound(tolerance.absolute, largestMagnitude), leafBound(tolerance.relative, largestMagnitude));
+
+    }
+
+} //namespace isEqualDetail
+
+//O(1), and false only when the two fingerprinted objects definitely aren't equal under this tolerance (see the top of this file)
+template <typename Tolerance = AbsoluteTolerance>
+inline bool mayBeEqual(const Fingerprint& fingerprint1, const Fingerprint& fingerprint2, const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE)){
+
+    const auto policy = isEqualDetail::toTolerancePolicy(tolerance);
+
+    if(fingerprint1.shape() != fingerprint2.shape() || fingerprint1.leafCount != fingerprint2.leafCount){
+
+        return false;
+
+    }
+
+    //Two strings get compared as strings, where only the code units count (and a char and a char16_t with the same code unit can be
+    //entirely different numbers). Strings further down could end up paired with strings as well, which makes their numbers worthless.
+    if(fingerprint1.isString && fingerprint2.isString){
+
+        return fingerprint1.stringHash == fingerprint2.stringHash;
+
+    }
+
+    if(fingerprint1.containsStrings && fingerprint2.containsStrings){
+
+        return true;
+
+    }
+
+    if(fingerprint1.allIntegral && fingerprint2.allIntegral && isEqualDetail::isBitwiseTolerance(policy) && fingerprint1.integerHash != fingerprint2.integerHash){
+
+        return false;
+
+    }
+
+    if(fingerprint1.leafCount == 0){
+
+        return true;
+
+    }
+
+    const double epsilon          = std::numeric_limits<double>::epsilon();
+    const double count            = static_cast<double>(fingerprint1.leafCount);
+    const double largestMagnitude = std::max({-fingerprint1.minimum, fingerprint1.maximum, -fingerprint2.minimum, fingerprint2.maximum});
+    //Pairs of floats get their differences (and relative bounds) worked out in float, so the bound gets float rounding's worth of headroom
+    const double bound            = std::max(0.0, isEqualDetail::leafBound(policy, largestMagnitude)) * (1 + 8 * std::numeric_limits<float>::epsilon());
+
+    //Every comparison below is written so that NaNs and infinities (which turn the differences into NaN) fall through to true
+    const double minimumSlack = 2 * epsilon * (std::abs(fingerprint1.minimum) + std::abs(fingerprint2.minimum));
+    const double maximumSlack = 2 * epsilon * (std::abs(fingerprint1.maximum) + std::abs(fingerprint2.maximum));
+    const double sumSlack     = 2 * count * epsilon * (fingerprint1.sumAbs + fingerprint2.sumAbs + count * bound);
+
+    if(std::abs(fingerprint1.minimum - fingerprint2.minimum) > bound + minimumSlack ||
+       std::abs(fingerprint1.maximum - fingerprint2.maximum) > bound + maximumSlack ||
+       std::abs(fingerprint1.sum     - fingerprint2.sum)     > count * bound + sumSlack){
+
+        return false;
+
+    }
+
+    return true;
+
+}
+
+/*
+ * An object and its fingerprint, computed once up front. Only const access to the object is handed out, so the two can't drift
+ * apart, and append() keeps the fingerprint current in O(size of the element) instead of re-walking everything.
+ */
+template <typename Comparable>
+class Fingerprinted{
+
+public:
+
+    explicit Fingerprinted(Comparable valueIn)
+        : value(std::move(valueIn)),
+          fingerprint(makeFingerprint(value)){
+
+        /* NOP */
+
+    }
+
+    const Comparable& get() const{
+
+        return value;
+
+    }
+
+    const Fingerprint& digest() const{
+
+        return fingerprint;
+
+    }
+
+    //Adds an element at the end (or wherever a map or set puts it). Elements a map or set already has get ignored, just like insert does.
+    template <typename Element>
+    void append(Element&& element){
+
+        if constexpr(isEqualDetail::string_traits<Comparable>::value){
+
+            //A string's new code unit is one more leaf and one more step of its hash, the same as makeFingerprint would've made them
+            using Traits = isEqualDetail::string_traits<Comparable>;
+
+            value.insert(value.end(), std::forward<Element>(element));
+
+            const auto& unit = Traits::data(value)[Traits::length(value) - 1];
+
+            fingerprint.add(makeFingerprint(isEqualDetail::codeUnitLeaf(unit)));
+            fingerprint.stringHash = isEqualDetail::foldIntoStringHash(fingerprint.stringHash, unit);
+
+        }
+        else{
+
+            Fingerprint elementFingerprint = makeFingerprint(element);
+            auto        sizeBefore         = isEqualDetail::adlSize(value);
+
+            value.insert(value.end(), std::forward<Element>(element));
+
+            if(isEqualDetail::adlSize(value) != sizeBefore){
+
+                fingerprint.add(elementFingerprint);
+
+            }
+
+        }
+
+    }
+
+private:
+
+    Comparable  value;
+    Fingerprint fingerprint;
+
+};
+
+//isEqual with the fingerprints checked first, so the candidates that clearly differ never get scanned. Always isEqual's exact answer.
+template <typename Comparable1, typename Comparable2, typename Tolerance = AbsoluteTolerance>
+inline bool isEqualFingerprinted(const Fingerprinted<Comparable1>& fingerprinted1, const Fingerprinted<Comparable2>& fingerprinted2,
+                                 const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE)){
+
+    return mayBeEqual(fingerprinted1.digest(), fingerprinted2.digest(), tolerance) && isEqual(fingerprinted1.get(), fingerprinted2.get(), tolerance);
+
+}
+
+//Against a candidate that isn't worth caching, whose fingerprint is then computed on the spot
+template <typename Comparable1, typename Comparable2, typename Tolerance = AbsoluteTolerance>
+inline bool isEqualFingerprinted(const Fingerprinted<Comparable1>& fingerprinted1, const Comparable2& comparable2,
+                                 const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE)){
+
+    return mayBeEqual(fingerprinted1.digest(), makeFingerprint(comparable2), tolerance) && isEqual(fingerprinted1.get(), comparable2, tolerance);
+
+}
+
+#endif //ISEQUALFINGERPRINT_H
@@ -0,0 +1,420 @@
+/* MIT License
+ *
+ * Copyright (c) 2020 B1anky
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#ifndef ISEQUALINSTRUMENTATION_H
+#define ISEQUALINSTRUMENTATION_H
+
+/*
+ * Instrumented, a reporter that keeps count of where comparisons go: which of isEqualWith's branches got taken and how often
+ * (the always false incompatible type fallback included, which is otherwise completely silent), how many elements and bytes were
+ * handed to a scan, how long each top level call took and whether it stopped early (unequal) or had to scan everything (equal).
+ *
+ *     ComparisonInstrumentation instrumentation;
+ *     Instrumented<>            reporter(instrumentation);
+ *
+ *     isEqualWith(config1, config2, 1E-6, reporter);
+ *     std::cout << instrumentation.toJson() << std::endl;
+ *
+ * It's a policy like the other reporters, so none of it exists unless you pass one. Instrumented<MismatchReport> keeps the report too,
+ * and any extra constructor arguments go to the reporter it wraps. Every thread gets its own block of counters the first time it
+ * compares something against a given ComparisonInstrumentation, which is the only time anything is allocated. After that the counters
+ * are only ever written by their own thread, with plain relaxed loads and stores, once per top level call, so nothing is locked
+ * and no cache line is shared. What happens in between is counted in the reporter itself.
+ * snapshot() (or toJson()) adds every thread's block up whenever you ask, from any thread, while they keep on counting.
+ * Keep the ComparisonInstrumentation alive for as long as anything may still compare against it.
+ */
+
+#include "isEqual.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+
+inline const char* comparisonBranchName(ComparisonBranch branch){
+
+    switch(branch){
+        case ComparisonBranch::Lookup:           return "lookup";
+        case ComparisonBranch::Map:              return "map";
+        case ComparisonBranch::String:           return "string";
+        case ComparisonBranch::UnrolledArray:    return "unrolled_array";
+        case ComparisonBranch::ContiguousRange:  return "contiguous";
+        case ComparisonBranch::StridedRange:     return "strided";
+        case ComparisonBranch::ReducedRange:     return "reduced";
+        case ComparisonBranch::Iterable:         return "iterable";
+        case ComparisonBranch::SinglePass:       return "single_pass";
+        case ComparisonBranch::Matrix:           return "matrix";
+        case ComparisonBranch::Nullptr:          return "nullptr";
+        case ComparisonBranch::Fundamental:      return "fundamental";
+        case ComparisonBranch::Tuple:            return "tuple";
+        case ComparisonBranch::Members:          return "members";
+        case ComparisonBranch::EqualityOperator: return "operator==";
+        case ComparisonBranch::Incompatible:     return "incompatible";
+        case ComparisonBranch::Count:            break;
+    }
+
+    return "unknown";
+
+}
+
+//Everything every thread has counted so far, added up
+struct InstrumentationSnapshot{
+
+    static constexpr std::size_t branchCount    = static_cast<std::size_t>(ComparisonBranch::Count);
+    static constexpr std::size_t latencyBuckets = 40;   //bucket 0 is under a nanosecond, bucket b is [2^(b-1), 2^b) ns, the last one takes everything longer
+
+    std::uint64_t threads          = 0;
+    std::uint64_t calls            = 0;   //top level isEqualWith calls, the recursion below them only shows up in the branches
+    std::uint64_t earlyExits       = 0;   //calls that came out unequal, which stop scanning at the first mismatch
+    std::uint64_t fullScans        = 0;   //calls that came out equal, which can only tell by scanning everything
+    std::uint64_t elements         = 0;
+    std::uint64_t bytes            = 0;
+    std::uint64_t totalNanoseconds = 0;
+
+    std::uint64_t branches[branchCount]   = {};
+    std::uint64_t latency[latencyBuckets] = {};
+
+    std::uint64_t branch(ComparisonBranch which) const{
+
+        return branches[static_cast<std::size_t>(which)];
+
+    }
+
+    static std::uint64_t bucketStart(std::size_t bucket){
+
+        return bucket == 0 ? 0 : std::uint64_t(1) << (bucket - 1);
+
+    }
+
+    //Buckets past the last one that's been hit are left out, i.e. {"calls": 3, ..., "branches": {"map": 1, ...}, "latencyNanoseconds": [{"atLeast": 0, "count": 0}, ...]}
+    std::string toJson() const{
+
+        std::ostringstream json;
+
+        json << "{\"threads\": " << threads << ", \"calls\": " << calls << ", \"earlyExits\": " << earlyExits << ", \"fullScans\": " << fullScans
+             << ", \"elements\": " << elements << ", \"bytes\": " << bytes << ", \"totalNanoseconds\": " << totalNanoseconds << ", \"branches\": {";
+
+        for(std::size_t index = 0; index < branchCount; ++index){
+
+            json << (index ? ", " : "") << "\"" << comparisonBranchName(static_cast<ComparisonBranch>(index)) << "\": " << branches[index];
+
+        }
+
+        json << "}, \"latencyNanoseconds\": [";
+
+        std::size_t usedBuckets = latencyBuckets;
+
+        while(usedBuckets > 0 && latency[usedBuckets - 1] == 0){
+
+            --usedBuckets;
+
+        }
+
+        for(std::size_t bucket = 0; bucket < usedBuckets; ++bucket){
+
+            json << (bucket ? ", " : "") << "{\"atLeast\": " << bucketStart(bucket) << ", \"count\": " << latency[bucket] << "}";
+
+        }
+
+        json << "]}";
+
+        return json.str();
+
+    }
+
+};
+
+namespace isEqualDetail{
+
+    //One thread's counters, on cache lines of their own. Only the owning thread ever writes them, so a relaxed load and store is
+    //all an increment takes, and snapshot() reading them from anywhere else just sees a count that's at most a little behind.
+    struct alignas(64) ThreadCounters{
+
+        std::atomic<std::uint64_t> calls{0};
+        std::atomic<std::uint64_t> earlyExits{0};
+        std::atomic<std::uint64_t> fullScans{0};
+        std::atomic<std::uint64_t> elements{0};
+        std::atomic<std::uint64_t> bytes{0};
+        std::atomic<std::uint64_t> totalNanoseconds{0};
+        std::atomic<std::uint64_t> branches[InstrumentationSnapshot::branchCount];
+        std::atomic<std::uint64_t> latency[InstrumentationSnapshot::latencyBuckets];
+
+        std::thread::id owner;
+        ThreadCounters* next = nullptr;
+
+        ThreadCounters(){
+
+            for(std::atomic<std::uint64_t>& branch : branches) branch.store(0, std::memory_order_relaxed);
+            for(std::atomic<std::uint64_t>& bucket : latency)  bucket.store(0, std::memory_order_relaxed);
+
+        }
+
+    };
+
+    inline void bump(std::atomic<std::uint64_t>& counter, std::uint64_t amount){
+
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+
+    }
+
+} //namespace isEqualDetail
+
+//The registry every thread's counters hang off of, see the top of this file. Each thread's block comes from the given memory
+//resource the first time that thread reports, possibly from several threads at once, so anything but a synchronized one
+//(a std::pmr::synchronized_pool_resource say) is only safe when a single thread ever compares through it.
+class ComparisonInstrumentation{
+
+public:
+
+    explicit ComparisonInstrumentation(std::pmr::memory_resource* resourceIn = std::pmr::get_default_resource())
+        : serial(nextSerial()),
+          allocator(resourceIn){
+
+        /* NOP */
+
+    }
+
+    ComparisonInstrumentation(const ComparisonInstrumentation&)            = delete;
+    ComparisonInstrumentation& operator=(const ComparisonInstrumentation&) = delete;
+
+    ~ComparisonInstrumentation(){
+
+        isEqualDetail::ThreadCounters* counters = head.load(std::memory_order_acquire);
+
+        while(counters){
+
+            isEqualDetail::ThreadCounters* next = counters->next;
+            counters->~ThreadCounters();
+            allocator.deallocate(counters, 1);
+            counters = next;
+
+        }
+
+    }
+
+    //The calling thread's block, found through a per thread cache of the last registry it used and only created (and pushed on
+    //the list without a lock) the first time. A thread id that gets reused after its thread ended picks the old block back up.
+    isEqualDetail::ThreadCounters& countersForThisThread(){
+
+        thread_local std::uint64_t                  cachedSerial   = 0;
+        thread_local isEqualDetail::ThreadCounters* cachedCounters = nullptr;
+
+        if(cachedSerial == serial){
+
+            return *cachedCounters;
+
+        }
+
+        std::thread::id                thisThread = std::this_thread::get_id();
+        isEqualDetail::ThreadCounters* counters   = head.load(std::memory_order_acquire);
+
+        while(counters && counters->owner != thisThread){
+
+            counters = counters->next;
+
+        }
+
+        if(!counters){
+
+            counters        = new(allocator.allocate(1)) isEqualDetail::ThreadCounters();
+            counters->owner = thisThread;
+            counters->next  = head.load(std::memory_order_relaxed);
+
+            while(!head.compare_exchange_weak(counters->next, counters, std::memory_order_release, std::memory_order_relaxed)){
+
+                /* NOP */
+
+            }
+
+        }
+
+        cachedSerial   = serial;
+        cachedCounters = counters;
+
+        return *counters;
+
+    }
+
+    InstrumentationSnapshot snapshot() const{
+
+        InstrumentationSnapshot total;
+
+        for(const isEqualDetail::ThreadCounters* counters = head.load(std::memory_order_acquire); counters; counters = counters->next){
+
+            total.threads          += 1;
+            total.calls            += counters->calls.load(std::memory_order_relaxed);
+            total.earlyExits       += counters->earlyExits.load(std::memory_order_relaxed);
+            total.fullScans        += counters->fullScans.load(std::memory_order_relaxed);
+            total.elements         += counters->elements.load(std::memory_order_relaxed);
+            total.bytes            += counters->bytes.load(std::memory_order_relaxed);
+            total.totalNanoseconds += counters->totalNanoseconds.load(std::memory_order_relaxed);
+
+            for(std::size_t index = 0; index < InstrumentationSnapshot::branchCount; ++index){
+
+                total.branches[index] += counters->branches[index].load(std::memory_order_relaxed);
+
+            }
+
+            for(std::size_t bucket = 0; bucket < InstrumentationSnapshot::latencyBuckets; ++bucket){
+
+                total.latency[bucket] += counters->latency[bucket].load(std::memory_order_relaxed);
+
+            }
+
+        }
+
+        return total;
+
+    }
+
+    std::string toJson() const{
+
+        return snapshot().toJson();
+
+    }
+
+private:
+
+    //Tells registries apart for the per thread cache, even one that ends up at the address of another that's been destroyed
+    static std::uint64_t nextSerial(){
+
+        static std::atomic<std::uint64_t> serials{0};
+
+        return serials.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    }
+
+    std::uint64_t                                                  serial;
+    std::pmr::polymorphic_allocator<isEqualDetail::ThreadCounters> allocator;
+    std::atomic<isEqualDetail::ThreadCounters*>                    head{nullptr};
+
+};
+
+/*
+ * The reporter itself. It picks up the calling thread's counters and starts the clock when a top level call begins,
+ * and everything nested inside that call counts into the same block. One per thread at a time, like any other reporter.
+ */
+template <typename Reporter = NoMismatchReport>
+class Instrumented : public Reporter{
+
+public:
+
+    static constexpr bool instrumented = true;
+
+    template <typename... Arguments>
+    explicit Instrumented(ComparisonInstrumentation& instrumentationIn, Arguments&&... arguments)
+        : Reporter(std::forward<Arguments>(arguments)...),
+          instrumentation(&instrumentationIn){
+
+        /* NOP */
+
+    }
+
+    void enterComparison(){
+
+        if(depth++ == 0){
+
+            counters = &instrumentation->countersForThisThread();
+            start    = std::chrono::steady_clock::now();
+
+        }
+
+    }
+
+    void leaveComparison(bool result){
+
+        if(--depth != 0){
+
+            return;
+
+        }
+
+        std::uint64_t nanoseconds = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        std::size_t   bucket      = 0;
+
+        while((nanoseconds >> bucket) != 0 && bucket + 1 < InstrumentationSnapshot::latencyBuckets){
+
+            ++bucket;
+
+        }
+
+        isEqualDetail::bump(counters->calls, 1);
+        isEqualDetail::bump(result ? counters->fullScans : counters->earlyExits, 1);
+        isEqualDetail::bump(counters->totalNanoseconds, nanoseconds);
+        isEqualDetail::bump(counters->latency[bucket], 1);
+        isEqualDetail::bump(counters->elements, elements);
+        isEqualDetail::bump(counters->bytes, bytes);
+
+        for(std::size_t index = 0; index < InstrumentationSnapshot::branchCount; ++index){
+
+            if(branches[index]){
+
+                isEqualDetail::bump(counters->branches[index], branches[index]);
+                branches[index] = 0;
+
+            }
+
+        }
+
+        elements = 0;
+        bytes    = 0;
+
+    }
+
+    //Counted in here and only handed to the thread's counters once the top level call is over, which keeps the atomics out of the element loops
+    void countBranch(ComparisonBranch branch, std::size_t elementsScanned, std::size_t bytesScanned){
+
+        branches[static_cast<std::size_t>(branch)] += 1;
+        elements                                   += elementsScanned;
+        bytes                                      += bytesScanned;
+
+    }
+
+private:
+
+    ComparisonInstrumentation*               instrumentation;
+    isEqualDetail::ThreadCounters*           counters = nullptr;
+    std::size_t                              depth    = 0;
+    std::chrono::steady_clock::time_point    start;
+    std::uint64_t                            elements = 0;
+    std::uint64_t                            bytes    = 0;
+    std::uint64_t                            branches[InstrumentationSnapshot::branchCount] = {};
+
+};
+
+//The plain boolean isEqual, counted into the given instrumentation
+template <typename Comparable1, typename Comparable2, typename Tolerance = AbsoluteTolerance>
+inline bool isEqualInstrumented(const Comparable1& comparable1, const Comparable2& comparable2, ComparisonInstrumentation& instrumentation,
+                                const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE)){
+
+    Instrumented<> reporter(instrumentation);
+
+    return isEqualWith(comparable1, comparable2, tolerance, reporter);
+
+}
+
+#endif //ISEQUALINSTRUMENTATION_H
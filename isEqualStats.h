@@ -0,0 +1,572 @@
+/* MIT License
+ *
+ * Copyright (c) 2020 B1anky
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#ifndef ISEQUALSTATS_H
+#define ISEQUALSTATS_H
+
+/*
+ * compareStats, for when "not equal" isn't enough and you need to know by how much. It walks the same things isEqual does
+ * (iterables, maps and sets, hashed or not, tuples and pairs, and any nesting of those, with strings counted as one exact value each) in a single pass, and instead of stopping
+ * at the first difference it keeps going and measures every pair of numbers it lines up:
+ *
+ *     DifferenceStats stats = compareStats(nightlyOutput, referenceOutput, 1E-6);
+ *
+ * Numbers are counted in the order the walk meets them, so overToleranceIndex is a position in that flattened order (run
+ * isEqualWith with a MismatchReport on the same inputs for the full path to it). Whether a pair is over tolerance is decided by exactly
+ * the same check isEqual uses, so stats.equal() and isEqual always agree. The error figures themselves are worked out in double
+ * and only cover pairs where both values are finite; pairs with a NaN or an infinity are counted on their own instead.
+ *
+ * Contiguous float and double data with an absolute tolerance (the default) gets reduced with AVX2 when the CPU has it, everything
+ * else goes through the scalar loop. The vectorized sums add up in a different order, so the mean and RMS can differ from the
+ * scalar ones in the last few bits. The maximums, counts and index never do.
+ */
+
+#include "isEqual.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <sstream>
+#include <tuple>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+
+struct DifferenceStats{
+
+    std::size_t elementCount       = 0;       //pairs of numbers compared
+    std::size_t finiteCount        = 0;       //those of them with both values finite, the only ones the error figures below cover
+    double      maxAbsoluteError   = 0.0;
+    double      maxRelativeError   = 0.0;     //|a - b| / max(|a|, |b|), 0 when both are 0
+    double      sumAbsoluteError   = 0.0;
+    double      sumSquaredError    = 0.0;
+    std::size_t overToleranceCount = 0;
+    std::size_t overToleranceIndex = 0;       //the first of them, only meaningful when overToleranceCount isn't 0
+    std::size_t nanCount           = 0;       //pairs with a NaN on either side
+    std::size_t infCount           = 0;       //pairs with an infinity on either side, and no NaN
+    std::size_t otherMismatches    = 0;       //sizes that differ, keys missing on one side, and unequal values that aren't numbers (operator==, isEqualMembers...)
+
+    double meanAbsoluteError() const{
+
+        return finiteCount ? sumAbsoluteError / static_cast<double>(finiteCount) : 0.0;
+
+    }
+
+    double rmsError() const{
+
+        return finiteCount ? std::sqrt(sumSquaredError / static_cast<double>(finiteCount)) : 0.0;
+
+    }
+
+    bool equal() const{
+
+        return overToleranceCount == 0 && otherMismatches == 0;
+
+    }
+
+    //All on one line, i.e. 1000000 values, max abs 2e-07, max rel 1e-08, mean abs 3e-08, rms 5e-08, 0 over tolerance, 0 NaN, 0 inf, 0 other
+    std::string toString() const{
+
+        std::ostringstream description;
+
+        description << elementCount << " values, max abs " << maxAbsoluteError << ", max rel " << maxRelativeError
+                    << ", mean abs " << meanAbsoluteError() << ", rms " << rmsError() << ", " << overToleranceCount << " over tolerance";
+
+        if(overToleranceCount){
+
+            description << " (first at " << overToleranceIndex << ")";
+
+        }
+
+        description << ", " << nanCount << " NaN, " << infCount << " inf, " << otherMismatches << " other";
+
+        return description.str();
+
+    }
+
+};
+
+namespace isEqualDetail{
+
+    //One pair of numbers, which is everything the vectorized reductions below have to reproduce
+    template <typename Arithmetic1, typename Arithmetic2, typename Tolerance>
+    inline void accumulateLeafStats(const Arithmetic1& arithmetic1, const Arithmetic2& arithmetic2, const Tolerance& tolerance, DifferenceStats& stats){
+
+        std::size_t index = stats.elementCount++;
+
+        if(!isWithinTolerance(arithmetic1, arithmetic2, tolerance)){
+
+            stats.overToleranceIndex = stats.overToleranceCount ? stats.overToleranceIndex : index;
+            ++stats.overToleranceCount;
+
+        }
+
+        double value1 = static_cast<double>(arithmetic1);
+        double value2 = static_cast<double>(arithmetic2);
+
+        if(std::isnan(value1) || std::isnan(value2)){
+
+            ++stats.nanCount;
+
+        }
+        else if(std::isinf(value1) || std::isinf(value2)){
+
+            ++stats.infCount;
+
+        }
+        else{
+
+            double absoluteError = std::fabs(value1 - value2);
+            double magnitude     = std::max(std::fabs(value1), std::fabs(value2));
+            double relativeError = magnitude != 0 ? absoluteError / magnitude : 0.0;
+
+            ++stats.finiteCount;
+            stats.maxAbsoluteError  = std::max(stats.maxAbsoluteError, absoluteError);
+            stats.maxRelativeError  = std::max(stats.maxRelativeError, relativeError);
+            stats.sumAbsoluteError += absoluteError;
+            stats.sumSquaredError  += absoluteError * absoluteError;
+
+        }
+
+    }
+
+    template <typename Arithmetic1, typename Arithmetic2, typename Tolerance>
+    inline void accumulateStatsScalar(const Arithmetic1* contiguous1, const Arithmetic2* contiguous2, std::size_t count, const Tolerance& tolerance,
+                                      DifferenceStats& stats){
+
+        for(std::size_t index = 0; index < count; ++index){
+
+            accumulateLeafStats(contiguous1[index], contiguous2[index], tolerance, stats);
+
+        }
+
+    }
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+    //Lambdas don't pick up the target attribute of the function they're in, so these can't be one
+    __attribute__((target("avx2"))) inline __m256d loadWidenedAVX2(const float*  values){ return _mm256_cvtps_pd(_mm_loadu_ps(values)); }
+    __attribute__((target("avx2"))) inline __m256d loadWidenedAVX2(const double* values){ return _mm256_loadu_pd(values);               }
+
+    //Four lanes of running figures, the counts kept as lane sums of the all ones (i.e. -1) masks and only added up at the very end
+    struct StatsLanesAVX2{
+
+        __m256d maxAbsolute;
+        __m256d maxRelative;
+        __m256d sumAbsolute;
+        __m256d sumSquared;
+        __m256i negativeFinite;
+        __m256i negativeNan;
+
+    };
+
+    /*
+     * accumulateLeafStats four pairs at a time, everything widened to double just like the scalar version does. The one thing that isn't
+     * done in double is float/float's tolerance check, which happens on the original floats against the rounded down float tolerance,
+     * exactly like isWithinTolerance. Non-finite lanes get masked out of the error figures before they can poison them.
+     * Answers with a bit set for every lane that's over tolerance.
+     */
+    template <typename Arithmetic1, typename Arithmetic2>
+    __attribute__((target("avx2")))
+    __attribute__((always_inline)) inline int accumulateStatsLanesAVX2(const Arithmetic1* contiguous1, const Arithmetic2* contiguous2, const AbsoluteTolerance& tolerance, StatsLanesAVX2& lanes){
+
+        const __m256d signMask = _mm256_set1_pd(-0.0);
+        const __m256d zero     = _mm256_setzero_pd();
+
+        __m256d value1        = loadWidenedAVX2(contiguous1);
+        __m256d value2        = loadWidenedAVX2(contiguous2);
+        __m256d absoluteError = _mm256_andnot_pd(signMask, _mm256_sub_pd(value1, value2));
+
+        //x - x is 0 for every finite x, and NaN for infinities and NaNs
+        __m256d finite    = _mm256_and_pd(_mm256_cmp_pd(_mm256_sub_pd(value1, value1), zero, _CMP_EQ_OQ),
+                                          _mm256_cmp_pd(_mm256_sub_pd(value2, value2), zero, _CMP_EQ_OQ));
+        __m256d nan       = _mm256_or_pd(_mm256_cmp_pd(value1, value1, _CMP_UNORD_Q), _mm256_cmp_pd(value2, value2, _CMP_UNORD_Q));
+        __m256d magnitude = _mm256_max_pd(_mm256_andnot_pd(signMask, value1), _mm256_andnot_pd(signMask, value2));
+        __m256d relative  = _mm256_and_pd(_mm256_div_pd(absoluteError, magnitude), _mm256_cmp_pd(magnitude, zero, _CMP_NEQ_OQ));
+
+        int withinMask = 0;
+
+        if constexpr(std::is_same_v<Arithmetic1, float> && std::is_same_v<Arithmetic2, float>){
+
+            __m128 floatError = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(_mm_loadu_ps(contiguous1), _mm_loadu_ps(contiguous2)));
+            withinMask = _mm_movemask_ps(_mm_cmp_ps(floatError, _mm_set1_ps(tolerance.floatValue), _CMP_LE_OQ));
+
+        }
+        else{
+
+            withinMask = _mm256_movemask_pd(_mm256_cmp_pd(absoluteError, _mm256_set1_pd(tolerance.value), _CMP_LE_OQ));
+
+        }
+
+        absoluteError = _mm256_and_pd(absoluteError, finite);
+        relative      = _mm256_and_pd(relative, finite);
+
+        lanes.maxAbsolute    = _mm256_max_pd(lanes.maxAbsolute, absoluteError);
+        lanes.maxRelative    = _mm256_max_pd(lanes.maxRelative, relative);
+        lanes.sumAbsolute    = _mm256_add_pd(lanes.sumAbsolute, absoluteError);
+        lanes.sumSquared     = _mm256_add_pd(lanes.sumSquared, _mm256_mul_pd(absoluteError, absoluteError));
+        lanes.negativeFinite = _mm256_add_epi64(lanes.negativeFinite, _mm256_castpd_si256(finite));
+        lanes.negativeNan    = _mm256_add_epi64(lanes.negativeNan, _mm256_castpd_si256(nan));
+
+        return ~withinMask & 0xF;
+
+    }
+
+    //Eight pairs per step over two independent sets of lanes, so neither the max nor the add chains stall on each other
+    template <typename Arithmetic1, typename Arithmetic2>
+    __attribute__((target("avx2")))
+    inline void accumulateStatsAVX2(const Arithmetic1* contiguous1, const Arithmetic2* contiguous2, std::size_t count, const AbsoluteTolerance& tolerance,
+                                    DifferenceStats& stats){
+
+        const __m256d zero = _mm256_setzero_pd();
+
+        StatsLanesAVX2 lanes0{zero, zero, zero, zero, _mm256_setzero_si256(), _mm256_setzero_si256()};
+        StatsLanesAVX2 lanes1 = lanes0;
+        std::size_t    index  = 0;
+
+        for(; index + 8 <= count; index += 8){
+
+            int overMask = accumulateStatsLanesAVX2(contiguous1 + index,     contiguous2 + index,     tolerance, lanes0) |
+                           accumulateStatsLanesAVX2(contiguous1 + index + 4, contiguous2 + index + 4, tolerance, lanes1) << 4;
+
+            if(overMask){
+
+                stats.overToleranceIndex  = stats.overToleranceCount ? stats.overToleranceIndex : stats.elementCount + index + __builtin_ctz(overMask);
+                stats.overToleranceCount += __builtin_popcount(overMask);
+
+            }
+
+        }
+
+        alignas(32) double       figures[8][4];
+        alignas(32) std::int64_t counts[4][4];
+
+        _mm256_store_pd(figures[0], lanes0.maxAbsolute);
+        _mm256_store_pd(figures[1], lanes0.maxRelative);
+        _mm256_store_pd(figures[2], lanes0.sumAbsolute);
+        _mm256_store_pd(figures[3], lanes0.sumSquared);
+        _mm256_store_pd(figures[4], lanes1.maxAbsolute);
+        _mm256_store_pd(figures[5], lanes1.maxRelative);
+        _mm256_store_pd(figures[6], lanes1.sumAbsolute);
+        _mm256_store_pd(figures[7], lanes1.sumSquared);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(counts[0]), lanes0.negativeFinite);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(counts[1]), lanes0.negativeNan);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(counts[2]), lanes1.negativeFinite);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(counts[3]), lanes1.negativeNan);
+
+        std::size_t finiteCount = 0;
+        std::size_t nanCount    = 0;
+
+        for(std::size_t lane = 0; lane < 4; ++lane){
+
+            stats.maxAbsoluteError  = std::max({stats.maxAbsoluteError, figures[0][lane], figures[4][lane]});
+            stats.maxRelativeError  = std::max({stats.maxRelativeError, figures[1][lane], figures[5][lane]});
+            stats.sumAbsoluteError += figures[2][lane] + figures[6][lane];
+            stats.sumSquaredError  += figures[3][lane] + figures[7][lane];
+
+            finiteCount -= static_cast<std::size_t>(counts[0][lane] + counts[2][lane]);
+            nanCount    -= static_cast<std::size_t>(counts[1][lane] + counts[3][lane]);
+
+        }
+
+        stats.finiteCount  += finiteCount;
+        stats.nanCount     += nanCount;
+        stats.infCount     += index - finiteCount - nanCount;
+        stats.elementCount += index;
+
+        accumulateStatsScalar(contiguous1 + index, contiguous2 + index, count - index, tolerance, stats);
+
+    }
+
+#endif //defined(__GNUC__) && defined(__x86_64__)
+
+    //Same split as compareContiguous: float and double pairs with an absolute tolerance get the kernel, the rest the scalar loop
+    template <typename Arithmetic1, typename Arithmetic2, typename Tolerance>
+    inline void accumulateStatsContiguous(const Arithmetic1* contiguous1, const Arithmetic2* contiguous2, std::size_t count, const Tolerance& tolerance,
+                                          DifferenceStats& stats){
+
+        #if defined(__GNUC__) && defined(__x86_64__)
+
+        if constexpr(std::is_same_v<Tolerance, AbsoluteTolerance>                                                     &&
+                     (std::is_same_v<Arithmetic1, float> || std::is_same_v<Arithmetic1, double>) &&
+                     (std::is_same_v<Arithmetic2, float> || std::is_same_v<Arithmetic2, double>)){
+
+            if(detectSimdLevel() >= SimdLevel::AVX2){
+
+                accumulateStatsAVX2(contiguous1, contiguous2, count, tolerance, stats);
+                return;
+
+            }
+
+        }
+
+        #endif //defined(__GNUC__) && defined(__x86_64__)
+
+        accumulateStatsScalar(contiguous1, contiguous2, count, tolerance, stats);
+
+    }
+
+    template <typename Comparable1, typename Comparable2, typename Tolerance>
+    void accumulateStats(const Comparable1& comparable1, const Comparable2& comparable2, const Tolerance& tolerance, DifferenceStats& stats);
+
+    //Walks both sides side by side as far as the shorter one goes, an extra element on either side counts as one mismatch for the lot
+    template <typename Iterator1, typename Sentinel1, typename Iterator2, typename Sentinel2, typename Tolerance>
+    void accumulateStatsLockstep(Iterator1 iter1, Sentinel1 end1, Iterator2 iter2, Sentinel2 end2, const Tolerance& tolerance, DifferenceStats& stats){
+
+        for(; iter1 != end1 && iter2 != end2; ++iter1, ++iter2){
+
+            accumulateStats(*iter1, *iter2, tolerance, stats);
+
+        }
+
+        stats.otherMismatches += (iter1 != end1 || iter2 != end2);
+
+    }
+
+    template <typename Tuple1, typename Tuple2, typename Tolerance, std::size_t ...Index>
+    void accumulateStatsTuple(const Tuple1& tuple1, const Tuple2& tuple2, const Tolerance& tolerance, DifferenceStats& stats, std::index_sequence<Index...>){
+
+        (accumulateStats(std::get<Index>(tuple1), std::get<Index>(tuple2), tolerance, stats), ...);
+
+    }
+
+    //The same branches as isEqualWith, in the same order, so everything lines up exactly the way isEqual lines it up
+    template <typename Comparable1, typename Comparable2, typename Tolerance>
+    void accumulateStats(const Comparable1& comparable1, const Comparable2& comparable2, const Tolerance& tolerance, DifferenceStats& stats){
+
+        if constexpr(is_lookup_comparable<Comparable1, Comparable2>::value){
+
+            //Walk one side and look every key up in the other (exactly, the same way isEqual does), whatever's left unmatched on either side is missing from the other
+            auto accumulateByLookup = [&tolerance, &stats](const auto& walked, const auto& lookedUp, auto swapped){
+
+                using Walked   = std::decay_t<decltype(walked)>;
+                using LookedUp = std::decay_t<decltype(lookedUp)>;
+
+                std::size_t matched = 0;
+
+                //A key's entries either all match (each value then measured against the first one isEqual pairs it with) or all count as missing
+                if constexpr(!is_unique_key<Walked>::value || !is_unique_key<LookedUp>::value){
+
+                    for(auto walkedIter = walked.begin(); walkedIter != walked.end();){
+
+                        const auto& key           = entryKey<Walked>(walkedIter);
+                        auto        walkedRange   = walked.equal_range(key);
+                        auto        lookedUpRange = equalRangeExactKey(lookedUp, key);
+
+                        if(isEqualKeyGroup<Walked>(walkedRange, lookedUpRange, tolerance, swapped)){
+
+                            matched += static_cast<std::size_t>(std::distance(lookedUpRange.first, lookedUpRange.second));
+
+                            if constexpr(is_unordered_map<Walked>::value || is_map<Walked>::value){
+
+                                for(auto entryIter = walkedRange.first; entryIter != walkedRange.second; ++entryIter){
+
+                                    auto partnerIter = lookedUpRange.first;
+
+                                    while(std::next(partnerIter) != lookedUpRange.second &&
+                                          !(decltype(swapped)::value ? isEqual(partnerIter->second, entryIter->second, tolerance) : isEqual(entryIter->second, partnerIter->second, tolerance))){
+
+                                        ++partnerIter;
+
+                                    }
+
+                                    if constexpr(decltype(swapped)::value) accumulateStats(partnerIter->second, entryIter->second, tolerance, stats);
+                                    else                                   accumulateStats(entryIter->second, partnerIter->second, tolerance, stats);
+
+                                }
+
+                            }
+
+                        }
+                        else{
+
+                            stats.otherMismatches += static_cast<std::size_t>(std::distance(walkedRange.first, walkedRange.second));
+
+                        }
+
+                        walkedIter = walkedRange.second;
+
+                    }
+
+                }
+                else{
+
+                    for(auto walkedIter = walked.begin(); walkedIter != walked.end(); ++walkedIter){
+
+                        if constexpr(is_unordered_map<Walked>::value || is_map<Walked>::value){
+
+                            auto lookedUpIter = findExactKey(lookedUp, walkedIter->first);
+
+                            if(lookedUpIter != lookedUp.end()){
+
+                                ++matched;
+
+                                if constexpr(decltype(swapped)::value) accumulateStats(lookedUpIter->second, walkedIter->second, tolerance, stats);
+                                else                                   accumulateStats(walkedIter->second, lookedUpIter->second, tolerance, stats);
+
+                            }
+                            else{
+
+                                ++stats.otherMismatches;
+
+                            }
+
+                        }
+                        else{
+
+                            bool found = findExactKey(lookedUp, *walkedIter) != lookedUp.end();
+
+                            matched               += found;
+                            stats.otherMismatches += !found;
+
+                        }
+
+                    }
+
+                }
+
+                stats.otherMismatches += adlSize(lookedUp) - matched;
+
+            };
+
+            if constexpr(lookup_direction<Comparable1, Comparable2>::intoComparable2){
+
+                accumulateByLookup(comparable1, comparable2, std::false_type{});
+
+            }
+            else{
+
+                accumulateByLookup(comparable2, comparable1, std::true_type{});
+
+            }
+
+        }
+        else if constexpr((is_map<Comparable1>::value && is_map<Comparable2>::value) || (is_set<Comparable1>::value && is_set<Comparable2>::value)){
+
+            //Keys line up exactly or not at all (as in isEqual), only the values of the entries whose keys do get measured
+            auto iter1 = adlBegin(comparable1);
+            auto iter2 = adlBegin(comparable2);
+
+            for(; iter1 != adlEnd(comparable1) && iter2 != adlEnd(comparable2); ++iter1, ++iter2){
+
+                if(!isExactKey(entryKey<Comparable1>(iter1), entryKey<Comparable2>(iter2))){
+
+                    ++stats.otherMismatches;
+
+                }
+                else if constexpr(is_map<Comparable1>::value){
+
+                    accumulateStats(iter1->second, iter2->second, tolerance, stats);
+
+                }
+
+            }
+
+            stats.otherMismatches += (iter1 != adlEnd(comparable1) || iter2 != adlEnd(comparable2));
+
+        }
+        else if constexpr(is_string_pair<Comparable1, Comparable2>::value){
+
+            //Strings are exact, there's no distance to measure, just equal or not
+            stats.otherMismatches += !compareStrings(comparable1, comparable2);
+
+        }
+        else if constexpr(is_iterable<Comparable1>::value && is_iterable<Comparable2>::value){
+
+            if constexpr(is_contiguous_arithmetic<Comparable1>::value && is_contiguous_arithmetic<Comparable2>::value){
+
+                std::size_t size1 = static_cast<std::size_t>(adlSize(comparable1));
+                std::size_t size2 = static_cast<std::size_t>(adlSize(comparable2));
+
+                accumulateStatsContiguous(adlData(comparable1), adlData(comparable2), std::min(size1, size2), tolerance, stats);
+
+                stats.otherMismatches += (size1 != size2);
+
+            }
+            else{
+
+                accumulateStatsLockstep(adlBegin(comparable1), adlEnd(comparable1), adlBegin(comparable2), adlEnd(comparable2), tolerance, stats);
+
+            }
+
+        }
+        else if constexpr(is_single_pass_iterable<Comparable1>::value && is_single_pass_iterable<Comparable2>::value){
+
+            accumulateStatsLockstep(adlBegin(comparable1), adlEnd(comparable1), adlBegin(comparable2), adlEnd(comparable2), tolerance, stats);
+
+        }
+        else if constexpr(std::is_null_pointer_v<Comparable1> && std::is_null_pointer_v<Comparable2>){
+
+            (void) comparable1;
+            (void) comparable2;
+
+        }
+        else if constexpr(std::is_arithmetic_v<Comparable1> && std::is_arithmetic_v<Comparable2>){
+
+            accumulateLeafStats(comparable1, comparable2, tolerance, stats);
+
+        }
+        else if constexpr(is_reduced_number_pair<Comparable1, Comparable2>::value){
+
+            accumulateLeafStats(widenReduced(comparable1), widenReduced(comparable2), tolerance, stats);
+
+        }
+        else if constexpr((is_pair<Comparable1>::value || is_tuple<Comparable1>::value) && (is_pair<Comparable2>::value || is_tuple<Comparable2>::value)){
+
+            if constexpr(std::tuple_size_v<Comparable1> == std::tuple_size_v<Comparable2>){
+
+                accumulateStatsTuple(comparable1, comparable2, tolerance, stats, std::make_index_sequence<std::tuple_size_v<Comparable1>>());
+
+            }
+            else{
+
+                ++stats.otherMismatches;
+
+            }
+
+        }
+        else{
+
+            //Nothing to measure inside these, so they're just equal or not
+            stats.otherMismatches += !isEqual(comparable1, comparable2, tolerance);
+
+        }
+
+    }
+
+} //namespace isEqualDetail
+
+//Everything about how far apart two things are, in one pass over both (see the top of this file)
+template <typename Comparable1, typename Comparable2, typename Tolerance = AbsoluteTolerance>
+inline DifferenceStats compareStats(const Comparable1& comparable1, const Comparable2& comparable2, const Tolerance& tolerance = AbsoluteTolerance(TOLERANCE)){
+
+    DifferenceStats stats;
+
+    isEqualDetail::accumulateStats(comparable1, comparable2, isEqualDetail::toTolerancePolicy(tolerance), stats);
+
+    return stats;
+
+}
+
+#endif //ISEQUALSTATS_H
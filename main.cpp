@@ -1,476 +1,1090 @@
-/* MIT License
- *
- * Copyright (c) 2020 B1anky
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
-*/
-
-#include <iostream>
-#include <type_traits>
-#include <vector>
-#include <list>
-#include <map>
-#include <cstddef>
-#include <tuple>
-#include <cmath>
-#include <functional>
-#include <string>
-
-//Swap 0 to a 1 for active debugging and more diagnostics
-#define DEBUGGING 0
-
-#define TOLERANCE 1E-5
-
-//This allows us to test for what we can freely "assume" to be iterable, you can make that more or less strict depending on use cases
-template <typename T>
-auto is_iterable_impl(int)
--> decltype (
-    begin(std::declval<T&>()) != end(std::declval<T&>()),   // begin/end and operator !=
-    void(),                                                 // Handle evil operator
-    size(std::declval<T&>()),                               // Handle safely getting the size, since most iterables have this function
-    ++std::declval<decltype(begin(std::declval<T&>()))&>(), // operator ++
-    --std::declval<decltype(begin(std::declval<T&>()))&>(), // operator --
-    void(*begin(std::declval<T&>())),                       // operator*
-    std::true_type{});
-
-//This will call the above template, if possible, but if not, will be of std::false_type at compilation time
-template <typename T>
-std::false_type is_iterable_impl(...);
-
-//naming this No because if No operator== exists, its value will be 0 (Get it? It's like english but worse)
-struct No {};
-template<typename T, typename Arg> No operator== (const T&, const Arg&);
-
-template<typename T, typename Arg = T>
-struct EqualExists
-{
-  enum { value = !std::is_same<decltype(std::declval<T>() == std::declval<Arg>()), No>::value };
-};
-
-//these two are for maps specifically, pretty simple, but we're only using the structs as a wrapper for the constexpr
-template <class T>
-struct is_map {
-    static constexpr bool value = false;
-};
-
-template<class Key, class Value>
-struct is_map<std::map<Key, Value>> {
-    static constexpr bool value = true;
-};
-
-//this one is for tuple types specifically
-template <typename>      struct is_tuple                   : std::false_type {};
-template <typename ...T> struct is_tuple<std::tuple<T...>> : std::true_type  {};
-
-//try to leverage the same behavior for std::pair now
-template <typename>               struct is_pair                  : std::false_type {};
-template <typename T, typename V> struct is_pair<std::pair<T, V>> : std::true_type  {};
-
-//this one makes iterables more legible when using them in the source code
-template <typename T>
-using is_iterable = decltype(is_iterable_impl<T>(0));
-
-//The following was found at: https://www.fluentcpp.com/2019/03/08/stl-algorithms-on-tuples/
-//This allows us to generically iterate over two tuples simulatenously and perform user-defined operations on it (super cool)
-template <class Tuple1, class Tuple2, class F, std::size_t... I>
-F for_each_tuple_element_impl(Tuple1&& t1, Tuple2&& t2, F&& f, std::index_sequence<I...>)
-{
-    return (void)std::initializer_list<int>{(std::forward<F>(f)(std::get<I>(std::forward<Tuple1>(t1)), std::get<I>(std::forward<Tuple2>(t2))),0)...}, f;
-}
-
-template <class Tuple1, class Tuple2, class F>
-constexpr decltype(auto) for_each_tuple_element(Tuple1&& t1, Tuple2&& t2, F&& f)
-{
-    return for_each_tuple_element_impl(std::forward<Tuple1>(t1), std::forward<Tuple2>(t2), std::forward<F>(f),
-                         std::make_index_sequence<std::tuple_size<std::remove_reference_t<Tuple1>>::value>{});
-}
-
-
-/*
- * This function is the meat and potatoes of the best implcit ==operator since sliced bread. (Probably)
- * Ever compare two floating points and need a tolerance because the darn rounding error got you?
- * I bet you've opted to use something along the line of fabs(float1 - float2) <= 0.0001 or the likes...
- * Now have you had to compare two containers of floats, which you assumed would be the same, but weren't?
- * This function can essentially do the above concept and apply it to any combination of types implcitly.
- * You have an int and a float? Great we can do that for you in a nice, convenient, small-form factor call.
- * You have two std::vector<float>s? Great we can do that for you too.
- * You have a std::vector<float> and a std::vector<double>, but they're so similar you'd expect them to be equal?
- * Well normally for differing container types likes that, the compiler will sadly make you have to write out
- * the explicit operator== like this:
- *
- *     bool operator==(const std::vector<float>& floatVector, const std::vector<double>& doubleVector){ ... }
- *
- * Hmmm... but what if we want the tolerance to be definable? Oops good luck with that without adding a layer of indirection.
- * Also god-forbid you reversed the order of the float and double, because you'll have to rewrite the entire thing again
- * to get it compiling for flipping your right and left hand side types. With all these layers of indirection, I think Shrek will be seeing you soon.
- * This magical isEqual function can do any-order tolerance comparison for free (generally).
- * You don't want a tolerance? Just supply a 0.0 on a per-case basis, or swap the above TOLERANCE define to: #define TOLERANCE 0.0
- * Yup, it's that easy.
- * B-b-but what about special types like tuples and pairs? Oh boy if you thought the above operator== nightmare with just
- * the std::vectors was bad, imagine if you have a bunch of similar sized tuples (and pairs obviously) and you want to compare them to each other?
- * Ding-ding-ding you're right, you couldn't before, but now you can!
- * Seriously, it's hard to make this not compile, because if it can fall into the else case, it'll just return false.
- * If it can't fall into any case, it just won't compile any of the cases into the template during the preprocessor stage and essentially just generate:
- * bool isEqualRet = false;
- * return isEqualRet;
- * Oh, by the way, be careful with pointer types. They can literally compare safely with anything, including a float, funnily enough, so
- * make sure you're dereferencing things unless they're both pointer types.
- */
-template <typename Comparable1, typename Comparable2>
-static inline bool isEqual(Comparable1 comparable1, Comparable2 comparable2, float tolerance = TOLERANCE){ //0.00001
-
-    bool isEqualRet = false;
-
-    //If we have mismatched map types but technically "could" be compared (i.e. a std::map<int, float> with a std::map<int, double> or a std::map<int, int>)
-    if constexpr(is_map<Comparable1>::value && is_map<Comparable2>::value){
-
-            //We should have a strict requirement of having a size since there's no standard for every container type
-            isEqualRet = (comparable1.size() == comparable2.size());
-
-            size_t indexError(0);
-
-            //We also had a strict requirement that the begin() and end() operators were to be defined
-            for(auto comparable1Iter = comparable1.begin(),
-                     comparable2Iter = comparable2.begin() ;
-                isEqualRet && (comparable1Iter != comparable1.end()) && (comparable2Iter != comparable2.end());
-                comparable1Iter++, comparable2Iter++){
-
-                //This is crazy that we can call ourself
-                isEqualRet = isEqual(*comparable1Iter, *comparable2Iter, tolerance);
-
-                ++indexError;
-
-            }
-
-            #if DEBUGGING
-
-            if(!isEqualRet){
-
-                std::cout << "is_map returned false starting at index: " << indexError << " of both maps. Could be type-mismatched or actually not equal." << std::endl;
-
-            }
-
-            #endif //DEBUGGING
-
-    }
-    //iterable containers, like std::vector or std::lists can natively be compared to each other here
-    else if constexpr(is_iterable<Comparable1>::value && is_iterable<Comparable2>::value){
-
-        //We should have a strict requirement of having a size since there's no standard for every container type
-        isEqualRet = (comparable1.size() == comparable2.size());
-
-        //We also had a strict requirement that the begin() and end() operators were to be defined
-        for(auto comparable1Iter = comparable1.begin(),
-                 comparable2Iter = comparable2.begin() ;
-            isEqualRet && (comparable1Iter != comparable1.end()) && (comparable2Iter != comparable2.end());
-            comparable1Iter++, comparable2Iter++){
-
-            //We also needed the *operator defined so we can dereference the iterator
-            isEqualRet = isEqual(*comparable1Iter, *comparable2Iter, tolerance);
-
-            #if DEBUGGING
-
-            if(!isEqualRet){
-
-                std::cout << "false (is_iterable)" << std::endl;
-                std::cout << fabs(*comparable1Iter - *comparable2Iter)     << " is not within tolerance threshold: " << tolerance << std::endl;
-                std::cout << *comparable1Iter << " - " << *comparable2Iter << " = " << *comparable1Iter - *comparable2Iter << std::endl;
-
-            }
-
-            #endif //DEBUGGING
-
-        }
-
-    }
-    else if constexpr( std::is_null_pointer_v<Comparable1> && std::is_null_pointer_v<Comparable2> ){
-
-        (void) tolerance;
-        isEqualRet = true;
-
-    }
-    else if constexpr( std::is_fundamental<Comparable1>::value && std::is_fundamental<Comparable2>::value ){
-
-        isEqualRet = (fabs(comparable1 - comparable2) <= tolerance);
-
-        #if DEBUGGING
-
-        if(!isEqualRet){
-
-            std::cout << "false (is_fundamental)" << std::endl;
-            std::cout << fabs(comparable1 - comparable2) << " is not within tolerance threshold: " << tolerance << " to " << comparable2 << std::endl;
-            std::cout << comparable1 << " - " << comparable2 << " = " << comparable1 - comparable2 << std::endl;
-
-        }
-
-        #endif //DEBUGGING
-
-    }
-    //The tuple or pair can be of any type we want, even with differing lengths and we can handle it through the following constexprs
-    else if constexpr( (is_pair<Comparable1>::value || is_tuple<Comparable1>::value) || (is_pair<Comparable2>::value || is_tuple<Comparable2>::value) ){
-
-        isEqualRet = std::tuple_size<Comparable1>::value == std::tuple_size<Comparable2>::value;
-
-        size_t indexError(0);
-
-        if constexpr( std::tuple_size<Comparable1>::value == std::tuple_size<Comparable2>::value){
-
-            for_each_tuple_element(comparable1, comparable2, [&isEqualRet, &tolerance, &indexError](auto&& i, auto&& s){
-                isEqualRet &= isEqual(i, s, tolerance);
-                if(isEqualRet) ++indexError;
-            });
-
-        }
-
-        #if DEBUGGING
-
-        if(!isEqualRet){
-
-            std::cout << "false (is_tuple / is_pair)" << std::endl;
-            std::cout << "is_tuple returned false starting at index: " << indexError << " of both tuples. Could be type-mismatched or actually not equal." << std::endl;
-
-        }
-
-        #endif //DEBUGGING
-
-
-    }
-    else if constexpr( EqualExists<Comparable1>::value && std::is_same<Comparable1, Comparable2>::value && !std::is_fundamental<Comparable1>::value){
-
-            (void) tolerance;
-            isEqualRet = comparable1 == comparable2;
-
-            #if DEBUGGING
-
-            if(!isEqualRet){
-
-                std::cout << "false (==operator)" << std::endl;
-
-            }
-
-            #endif //DEBUGGING
-
-    }
-    //Either Comparable1 is iterable and Comparable2 is not, or vice versa
-    else{        
-
-        //Unused warning suppression for when the else case is compiled
-        (void) comparable1;
-        (void) comparable2;
-        (void) tolerance;        
-
-        #if DEBUGGING
-
-        std::cout << "false (Types are incompatible, this will always return false.)" << std::endl;
-
-        #endif //DEBUGGING
-
-        isEqualRet = false;
-
-    }
-
-    return isEqualRet;
-
-}
-
-//Random test class with some varying types and an operator== overload
-class ImplictlyCompareMeCorrectly{
-
-public:
-
-    ImplictlyCompareMeCorrectly()
-        : i(0),
-          f(0.0),
-          d(0.0){
-
-        /* NOP */
-
-    }
-
-    ImplictlyCompareMeCorrectly(int iIn, float fIn, double dIn, std::vector<double> doubleVectorIn)
-        :       i(iIn),
-                f(fIn),
-                d(dIn),
-          dVector(doubleVectorIn){
-
-        /* NOP */
-
-    }
-
-    ImplictlyCompareMeCorrectly(const ImplictlyCompareMeCorrectly& other)
-        :       i(other.i),
-                f(other.f),
-                d(other.d),
-          dVector(other.dVector){
-
-        /* NOP */
-
-    }
-
-    ImplictlyCompareMeCorrectly& operator=(const ImplictlyCompareMeCorrectly& other){
-
-        if(this != &other){
-
-                  i = other.i;
-                  f = other.f;
-                  d = other.d;
-            dVector = other.dVector;
-
-        }
-
-        return *this;
-
-    }
-
-    bool operator==(const ImplictlyCompareMeCorrectly& other) const{
-
-        return isEqual(i,       other.i)        &&
-               isEqual(f,       other.f)        &&
-               isEqual(d,       other.d)        &&
-               isEqual(dVector, other.dVector);
-
-    }
-
-    bool operator!=(const ImplictlyCompareMeCorrectly& other) const{
-
-        return !(*this == other);
-
-    }
-
-public:
-
-    int                 i;
-    float               f;
-    double              d;
-    std::vector<double> dVector;
-
-};
-
-int main(){
-
-    std::cout << std::boolalpha;
-
-    //Standard primitive tests
-    std::cout << "if 1 and 0 are equal: "
-              << isEqual(1, 0) << std::endl << std::endl;
-    std::cout << "if 1 and 1 are equal: "
-              << isEqual(1, 1) << std::endl << std::endl;
-    std::cout << "if 1 and 2 are equal with a tolerance of ~1.0: "
-              << isEqual(1, 2, 1.0) << std::endl << std::endl;
-    std::cout << "if 1.0 and 2.9 are equal with a tolerance of ~1.0: "
-              << isEqual(1.0, 2.9, 1.0) << std::endl << std::endl;
-    std::cout << "if 1.0 and 1.0 are equal with a tolerance of ~0.0: "
-              << isEqual(1.0, 1.0, 0.0) << std::endl << std::endl;
-
-    std::vector<float>    floatVector  = {1.2, 36.6, 25.11, 22.44};
-    std::vector<double>   doubleVector = {1.2, 36.6, 25.11, 22.44};
-    std::list<int>        intList      = {2, 36, 25, 22};
-
-    //Iterable tests
-    std::cout << "if a std::vector<float> and a std::vector<double>\nwith equivalent initializer list are equal: "
-              << isEqual(floatVector, doubleVector, 1E-5) << std::endl << std::endl;
-
-    //This will be the else case that always returns false since we're comparing an iterable with a non-iterable
-    std::cout << "if a std::vector<float> and a float are equal: "
-              << isEqual(floatVector, 2.9) << std::endl << std::endl;
-
-    std::cout << "if a std::vector<float> and a std::list<int>\nwith similar initializer lists are equal with a default tolerance: "
-              << isEqual(floatVector, intList) << std::endl << std::endl;
-
-    std::cout << "if a std::vector<float> and a std::list<int>\nwith similar initializer lists are equal with a 1.0 tolerance: "
-              << isEqual(floatVector, intList, 1.0) << std::endl << std::endl;
-
-
-    ImplictlyCompareMeCorrectly test1(1, 2.3,  64.36435, {1, 2, 3});
-    ImplictlyCompareMeCorrectly test2(1, 2.3,  64.36435, {1, 2, 3});
-    ImplictlyCompareMeCorrectly test3(2, 4.6, 128.72870, {4, 5, 6});
-
-    //Custom classes with an operator== overload defined
-    std::cout << "if a custom class with an operator== is well-defined\nwith two similarly initialized classes are equal: "
-              << isEqual(test1, test2) << std::endl << std::endl;
-    std::cout << "if a custom class with an operator== is well-defined\nwith two differently initialized classes are equal: "
-              << isEqual(test1, test3) << std::endl << std::endl;
-
-    std::tuple<int, int, int> tupleTest1 = {1, 2, 3};
-    std::tuple<int, int, int> tupleTest2 = {1, 2, 3};
-    std::tuple<int, short, ImplictlyCompareMeCorrectly> tupleTest3 = {2, 5, test1};
-    std::tuple<int, short, ImplictlyCompareMeCorrectly> tupleTest4 = {2, 5, test1};
-
-    //std::tuple tests
-    std::cout << "if two std::tuple<int, int, int>s initialized with the same initializer lists are equal with a default tolerance: "
-              << isEqual(tupleTest1, tupleTest2) << std::endl << std::endl;
-    std::cout << "if two std::tuple<int, short, ImplictlyCompareMeCorrectly>s initialized with the same initializer lists are equal with a default tolerance: "
-              << isEqual(tupleTest3, tupleTest3) << std::endl << std::endl;
-
-    std::pair<int, int>      pairTest1 = {1  , 2  };
-    std::pair<int, int>      pairTest2 = {1  , 2  };
-    std::pair<double, float> pairTest3 = {1.0, 2.0};
-    std::pair<ImplictlyCompareMeCorrectly, float> pairTest4 = {test1, 5.0};
-    std::pair<ImplictlyCompareMeCorrectly, int>   pairTest5 = {test1, 5  };
-
-    //std::pair tests
-    std::cout << "if two std::pair<int, int>s initialized with the same initializer lists are equal with a default tolerance: "
-              << isEqual(pairTest1, pairTest2) << std::endl << std::endl;
-    std::cout << "if a std::pair<int, int> and std::pair<double, float> with very similar initializer lists are equal with a default tolerance: "
-              << isEqual(pairTest1, pairTest3) << std::endl << std::endl;
-    std::cout << "if a std::pair<ImplictlyCompareMeCorrectly, float> and a std::pair<ImplictlyCompareMeCorrectly, int> "
-                 "with very similar initializer lists are equal with a default tolerance: "
-              << isEqual(pairTest4, pairTest5) << std::endl << std::endl;
-
-    std::map<int, double> map1 = { {1, 1.2}, {36, 36.6}, {25, 25.11}, {22, 22.44} };
-    std::map<int, double> map2 = { {1, 1.2}, {36, 36.6}, {25, 25.11}, {22, 22.44} };
-    std::map<int, float>  map3 = { {1, 1.2}, {36, 36.6}, {25, 25.11}, {22, 22.44} };
-
-    //std::map tests
-    std::cout << "if a std::map<int, double>'s values and a std::map<int, double>'s\nwith equivalent initializer lists are equal with a default tolerance: "
-              << isEqual(map1, map2) << std::endl << std::endl;
-    std::cout << "if a std::map<int, double>'s values and a std::map<int, float>'s\nwith equivalent initializer lists are equal with a default tolerance: "
-              << isEqual(map1, map3) << std::endl << std::endl;
-
-    std::tuple<int, int> fakeIntPair = {5, 10};
-    std::pair<int, int>  realIntPair = {5, 10};
-
-    //The real icing on the cake it probably the behavior that a std::tuple of two elemenst and an std::pair are essentially comparable implicitly
-    //Uncomment this and have fun with the compiler generated errors
-    //std::cout << (fakeIntPair == realIntPair);
-    //Here it just works, like magic
-    std::cout << "if a std::tuple<int, int> and a std::pair<int, int> with equivalent initializer lists are equal with a default tolerance: "
-              << isEqual(fakeIntPair, realIntPair) << std::endl << std::endl;
-
-    //If you want to play with the pointers, go ahead, uncomment this block
-
-    /*
-     *  int* intPtr      = new int(5);
-     *  int* otherIntPtr = intPtr;
-     *  isEqual(intPtr, otherIntPtr);  //will be true
-     *  isEqual(nullptr, otherIntPtr); //will be false
-     *  isEqual(nullptr, nullptr);
-     *
-     *  int* ourNullptr      = nullptr;
-     *  int* ourOtherNullptr = nullptr;
-     *  isEqual(ourNullptr, ourOtherNullptr); //Luckily returns true
-     *
-     *  int* ourUninitializedPtr;
-     *  int* ourOtherUninitializedPtr;
-     *  isEqual(ourUninitializedPtr, ourOtherUninitializedPtr); //This one depends on if your system nulls out memory for you, so it's undefined behavior
-     */
-
-    return 0;
-
-}
+/* MIT License
+ *
+ * Copyright (c) 2020 B1anky
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+
+#include "isEqual.h"
+#include "isEqualFingerprint.h"
+#include "isEqualStats.h"
+#include "isEqualInstrumentation.h"
+
+#include <iostream>
+#include <vector>
+#include <list>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstddef>
+#include <tuple>
+#include <string>
+#include <string_view>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <random>
+#include <limits>
+#include <array>
+#include <cstdint>
+#include <cmath>
+#include <forward_list>
+#include <sstream>
+#include <iterator>
+#include <optional>
+#include <memory_resource>
+#include <algorithm>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+//isEqualFile.h is POSIX only (mmap and madvise)
+#if __has_include(<sys/mman.h>)
+#include "isEqualFile.h"
+#include <fstream>
+#include <filesystem>
+#include <cstdio>
+#endif
+
+//Random test class with some varying types and an operator== overload
+class ImplictlyCompareMeCorrectly{
+
+public:
+
+    ImplictlyCompareMeCorrectly()
+        : i(0),
+          f(0.0),
+          d(0.0){
+
+        /* NOP */
+
+    }
+
+    ImplictlyCompareMeCorrectly(int iIn, float fIn, double dIn, std::vector<double> doubleVectorIn)
+        :       i(iIn),
+                f(fIn),
+                d(dIn),
+          dVector(doubleVectorIn){
+
+        /* NOP */
+
+    }
+
+    ImplictlyCompareMeCorrectly(const ImplictlyCompareMeCorrectly& other)
+        :       i(other.i),
+                f(other.f),
+                d(other.d),
+          dVector(other.dVector){
+
+        /* NOP */
+
+    }
+
+    ImplictlyCompareMeCorrectly& operator=(const ImplictlyCompareMeCorrectly& other){
+
+        if(this != &other){
+
+                  i = other.i;
+                  f = other.f;
+                  d = other.d;
+            dVector = other.dVector;
+
+        }
+
+        return *this;
+
+    }
+
+    bool operator==(const ImplictlyCompareMeCorrectly& other) const{
+
+        NoMismatchReport noReport;
+
+        return isEqualMembers(other, AbsoluteTolerance(TOLERANCE), noReport);
+
+    }
+
+    //isEqual picks this up on its own, which lets it pass its tolerance along and name the member that differed in a MismatchReport
+    template <typename Tolerance, typename Reporter>
+    bool isEqualMembers(const ImplictlyCompareMeCorrectly& other, const Tolerance& tolerance, Reporter& reporter) const{
+
+        return isEqualMember("i",       i,       other.i,       tolerance, reporter) &&
+               isEqualMember("f",       f,       other.f,       tolerance, reporter) &&
+               isEqualMember("d",       d,       other.d,       tolerance, reporter) &&
+               isEqualMember("dVector", dVector, other.dVector, tolerance, reporter);
+
+    }
+
+    bool operator!=(const ImplictlyCompareMeCorrectly& other) const{
+
+        return !(*this == other);
+
+    }
+
+public:
+
+    int                 i;
+    float               f;
+    double              d;
+    std::vector<double> dVector;
+
+};
+
+//Every call to the global operator new bumps this, so the demo below can prove isEqual never allocates (or copies) anything
+static std::atomic<std::size_t> allocationCount(0);
+
+//All of these are kept out of line, otherwise GCC pairs the inlined malloc()/free() calls with new/delete and warns about a mismatch that isn't there
+[[gnu::noinline]] void* operator new(std::size_t size){
+
+    ++allocationCount;
+
+    if(void* allocation = std::malloc(size ? size : 1)){
+
+        return allocation;
+
+    }
+
+    throw std::bad_alloc();
+
+}
+
+[[gnu::noinline]] void operator delete(void* allocation) noexcept{
+
+    std::free(allocation);
+
+}
+
+[[gnu::noinline]] void operator delete(void* allocation, std::size_t) noexcept{
+
+    std::free(allocation);
+
+}
+
+//std::pmr::new_delete_resource() (the default memory resource) allocates through the aligned overloads, so they get counted as well
+[[gnu::noinline]] void* operator new(std::size_t size, std::align_val_t alignment){
+
+    ++allocationCount;
+
+    std::size_t alignmentBytes = static_cast<std::size_t>(alignment);
+
+    if(void* allocation = std::aligned_alloc(alignmentBytes, (std::max<std::size_t>(1, size) + alignmentBytes - 1) / alignmentBytes * alignmentBytes)){
+
+        return allocation;
+
+    }
+
+    throw std::bad_alloc();
+
+}
+
+[[gnu::noinline]] void operator delete(void* allocation, std::align_val_t) noexcept{
+
+    std::free(allocation);
+
+}
+
+[[gnu::noinline]] void operator delete(void* allocation, std::size_t, std::align_val_t) noexcept{
+
+    std::free(allocation);
+
+}
+
+//How many of the results below came out other than they should have, main fails if any did
+static std::size_t failedChecks = 0;
+
+//Hands a result straight back to be printed, counting it as failed if it isn't the one it should be
+template <typename Result>
+static Result expect(const Result& result, const typename std::common_type<Result>::type& expected){
+
+    if(!(result == expected)){
+
+        ++failedChecks;
+
+    }
+
+    return result;
+
+}
+
+#if __has_include(<sys/mman.h>)
+
+//A headerBytes long header of zeros, then the values as raw bytes in the machine's own byte order
+template <typename Element>
+static void writeElementFile(const std::string& path, std::size_t headerBytes, const std::vector<Element>& values){
+
+    std::ofstream file(path, std::ios::binary);
+
+    file.write(std::string(headerBytes, '\0').data(), static_cast<std::streamsize>(headerBytes));
+    file.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(Element)));
+
+}
+
+#endif
+
+int main(){
+
+    std::cout << std::boolalpha;
+
+    //Standard primitive tests
+    std::cout << "if 1 and 0 are equal: "
+              << expect(isEqual(1, 0), false) << std::endl << std::endl;
+    std::cout << "if 1 and 1 are equal: "
+              << expect(isEqual(1, 1), true) << std::endl << std::endl;
+    std::cout << "if 1 and 2 are equal with a tolerance of ~1.0: "
+              << expect(isEqual(1, 2, 1.0), true) << std::endl << std::endl;
+    std::cout << "if 1.0 and 2.9 are equal with a tolerance of ~1.0: "
+              << expect(isEqual(1.0, 2.9, 1.0), false) << std::endl << std::endl;
+    std::cout << "if 1.0 and 1.0 are equal with a tolerance of ~0.0: "
+              << expect(isEqual(1.0, 1.0, 0.0), true) << std::endl << std::endl;
+
+    std::vector<float>    floatVector  = {1.2, 36.6, 25.11, 22.44};
+    std::vector<double>   doubleVector = {1.2, 36.6, 25.11, 22.44};
+    std::list<int>        intList      = {2, 36, 25, 22};
+
+    //Iterable tests
+    std::cout << "if a std::vector<float> and a std::vector<double>\nwith equivalent initializer list are equal: "
+              << expect(isEqual(floatVector, doubleVector, 1E-5), true) << std::endl << std::endl;
+
+    //This will be the else case that always returns false since we're comparing an iterable with a non-iterable
+    std::cout << "if a std::vector<float> and a float are equal: "
+              << expect(isEqual(floatVector, 2.9), false) << std::endl << std::endl;
+
+    std::cout << "if a std::vector<float> and a std::list<int>\nwith similar initializer lists are equal with a default tolerance: "
+              << expect(isEqual(floatVector, intList), false) << std::endl << std::endl;
+
+    std::cout << "if a std::vector<float> and a std::list<int>\nwith similar initializer lists are equal with a 1.0 tolerance: "
+              << expect(isEqual(floatVector, intList, 1.0), true) << std::endl << std::endl;
+
+
+    ImplictlyCompareMeCorrectly test1(1, 2.3,  64.36435, {1, 2, 3});
+    ImplictlyCompareMeCorrectly test2(1, 2.3,  64.36435, {1, 2, 3});
+    ImplictlyCompareMeCorrectly test3(2, 4.6, 128.72870, {4, 5, 6});
+
+    //Custom classes with an operator== overload defined
+    std::cout << "if a custom class with an operator== is well-defined\nwith two similarly initialized classes are equal: "
+              << expect(isEqual(test1, test2), true) << std::endl << std::endl;
+    std::cout << "if a custom class with an operator== is well-defined\nwith two differently initialized classes are equal: "
+              << expect(isEqual(test1, test3), false) << std::endl << std::endl;
+
+    std::tuple<int, int, int> tupleTest1 = {1, 2, 3};
+    std::tuple<int, int, int> tupleTest2 = {1, 2, 3};
+    std::tuple<int, short, ImplictlyCompareMeCorrectly> tupleTest3 = {2, 5, test1};
+    std::tuple<int, short, ImplictlyCompareMeCorrectly> tupleTest4 = {2, 5, test1};
+
+    //std::tuple tests
+    std::cout << "if two std::tuple<int, int, int>s initialized with the same initializer lists are equal with a default tolerance: "
+              << expect(isEqual(tupleTest1, tupleTest2), true) << std::endl << std::endl;
+    std::cout << "if two std::tuple<int, short, ImplictlyCompareMeCorrectly>s initialized with the same initializer lists are equal with a default tolerance: "
+              << expect(isEqual(tupleTest3, tupleTest3), true) << std::endl << std::endl;
+
+    std::pair<int, int>      pairTest1 = {1  , 2  };
+    std::pair<int, int>      pairTest2 = {1  , 2  };
+    std::pair<double, float> pairTest3 = {1.0, 2.0};
+    std::pair<ImplictlyCompareMeCorrectly, float> pairTest4 = {test1, 5.0};
+    std::pair<ImplictlyCompareMeCorrectly, int>   pairTest5 = {test1, 5  };
+
+    //std::pair tests
+    std::cout << "if two std::pair<int, int>s initialized with the same initializer lists are equal with a default tolerance: "
+              << expect(isEqual(pairTest1, pairTest2), true) << std::endl << std::endl;
+    std::cout << "if a std::pair<int, int> and std::pair<double, float> with very similar initializer lists are equal with a default tolerance: "
+              << expect(isEqual(pairTest1, pairTest3), true) << std::endl << std::endl;
+    std::cout << "if a std::pair<ImplictlyCompareMeCorrectly, float> and a std::pair<ImplictlyCompareMeCorrectly, int> "
+                 "with very similar initializer lists are equal with a default tolerance: "
+              << expect(isEqual(pairTest4, pairTest5), true) << std::endl << std::endl;
+
+    std::map<int, double> map1 = { {1, 1.2}, {36, 36.6}, {25, 25.11}, {22, 22.44} };
+    std::map<int, double> map2 = { {1, 1.2}, {36, 36.6}, {25, 25.11}, {22, 22.44} };
+    std::map<int, float>  map3 = { {1, 1.2}, {36, 36.6}, {25, 25.11}, {22, 22.44} };
+
+    //std::map tests
+    std::cout << "if a std::map<int, double>'s values and a std::map<int, double>'s\nwith equivalent initializer lists are equal with a default tolerance: "
+              << expect(isEqual(map1, map2), true) << std::endl << std::endl;
+    std::cout << "if a std::map<int, double>'s values and a std::map<int, float>'s\nwith equivalent initializer lists are equal with a default tolerance: "
+              << expect(isEqual(map1, map3), true) << std::endl << std::endl;
+
+    std::tuple<int, int> fakeIntPair = {5, 10};
+    std::pair<int, int>  realIntPair = {5, 10};
+
+    //The real icing on the cake it probably the behavior that a std::tuple of two elemenst and an std::pair are essentially comparable implicitly
+    //Uncomment this and have fun with the compiler generated errors
+    //std::cout << (fakeIntPair == realIntPair);
+    //Here it just works, like magic
+    std::cout << "if a std::tuple<int, int> and a std::pair<int, int> with equivalent initializer lists are equal with a default tolerance: "
+              << expect(isEqual(fakeIntPair, realIntPair), true) << std::endl << std::endl;
+
+    double                   cArray1[]   = {1.2, 36.6, 25.11, 22.44};
+    float                    cArray2[]   = {1.2, 36.6, 25.11, 22.44};
+    std::string_view         stringView1 = "isEqual";
+    std::string              string1     = "isEqual";
+    ArrayView<const double>  arrayView   = makeArrayView(std::as_const(doubleVector).data(), doubleVector.size());
+
+    //Non-owning views and C arrays, none of which get copied
+    std::cout << "if a double[4] and a float[4] with equivalent initializer lists are equal with a default tolerance: "
+              << expect(isEqual(cArray1, cArray2), true) << std::endl << std::endl;
+    std::cout << "if an ArrayView<const double> and a std::vector<float> with equivalent values are equal with a default tolerance: "
+              << expect(isEqual(arrayView, floatVector), true) << std::endl << std::endl;
+    std::cout << "if a std::string_view and a std::string with the same characters are equal: "
+              << expect(isEqual(stringView1, string1), true) << std::endl << std::endl;
+
+    #if __cplusplus >= 202002L && __has_include(<span>)
+
+    std::cout << "if a std::span<const float> and a double[4] with equivalent values are equal with a default tolerance: "
+              << expect(isEqual(std::span<const float>(floatVector), cArray1), true) << std::endl << std::endl;
+
+    #endif
+
+    const char*       headerName    = "Content-Length";
+    std::vector<char> charVector    = {'i', 's', 'E', 'q', 'u', 'a', 'l'};
+    std::string       appleString   = "apple";
+    std::string       applyString   = "apply";
+    char              buffer1[8]    = {'a', 'b', '\0', 'x'};
+    char              buffer2[8]    = {'a', 'b', '\0', 'y'};
+
+    //String tests, exact whatever the tolerance, and without a temporary std::string in sight
+    std::cout << "if a std::string \"apple\" and a std::string \"apply\" are equal with a tolerance of 1 (the characters aren't numbers): "
+              << expect(isEqual(appleString, applyString, 1.0), false) << std::endl << std::endl;
+    std::cout << "if a std::vector<char>, a const char* and a std::string_view spelling the same word are all equal: "
+              << expect((isEqual(charVector, "isEqual") && isEqual(charVector, stringView1)), true) << std::endl << std::endl;
+    std::cout << "if \"Content-Length\" and \"content-length\" are equal, and equal ignoring ASCII case: "
+              << expect(isEqual(headerName, "content-length"), false) << " and " << expect(isEqual(asciiCaseInsensitive(headerName), "content-length"), true) << std::endl << std::endl;
+    std::cout << "if two char[8] buffers that only differ after their first NUL are equal (a char array is all of its chars): "
+              << expect(isEqual(buffer1, buffer2), false) << std::endl << std::endl;
+
+    double                             rowMajorValues[6]    = {1.2, 36.6, 25.11, 22.44, 0.0, -1.0};
+    float                              columnMajorValues[6] = {1.2f, 22.44f, 36.6f, 0.0f, 25.11f, -1.0f};
+    std::vector<double>                middleColumn         = {36.6, 0.0};
+    std::vector<std::array<float, 3>>  pointCloud1          = {{1.2f, 36.6f, 25.11f}, {22.44f, 0.0f, -1.0f}};
+    std::vector<std::array<double, 3>> pointCloud2          = {{1.2, 36.6, 25.11}, {22.44, 0.0, -1.0}};
+
+    MatrixView<double> rowMajorMatrix    = MatrixView<double>::rowMajor(rowMajorValues, 2, 3);
+    MatrixView<float>  columnMajorMatrix = MatrixView<float>::columnMajor(columnMajorValues, 2, 3);
+
+    //Strided and multidimensional tests, different layouts of the same numbers compared right where they are
+    std::cout << "if a row-major 2x3 MatrixView<double> and a column-major 2x3 MatrixView<float> of the same matrix are equal with a default tolerance: "
+              << expect(isEqual(rowMajorMatrix, columnMajorMatrix), true) << std::endl << std::endl;
+    std::cout << "if that row-major matrix and its column-major twin transposed are equal: "
+              << expect(isEqual(rowMajorMatrix, columnMajorMatrix.transposed()), false) << std::endl << std::endl;
+    std::cout << "if the middle column of the column-major matrix, as a StridedView, and a std::vector<double> with the same values are equal: "
+              << expect(isEqual(columnMajorMatrix.column(1), middleColumn), true) << std::endl << std::endl;
+    std::cout << "if a std::vector<std::array<float, 3>> and a std::vector<std::array<double, 3>> point cloud with the same points are equal: "
+              << expect(isEqual(pointCloud1, pointCloud2), true) << std::endl << std::endl;
+
+    std::vector<std::array<std::array<double, 2>, 2>> nestedBlocks(1 << 17, {{{1.2, 36.6}, {25.11, 22.44}}});
+    std::vector<std::array<double, 4>>                flatBlocks  (1 << 17, {1.2, 36.6, 25.11, 22.44});
+    std::vector<std::array<float, 1>>                 singletons   = {{1.2f}, {36.6f}, {25.11f}, {22.44f}};
+
+    //Only runs of the same shape get flattened, the same count of numbers nested differently is still two incompatible types, whichever way it's asked
+    std::cout << "if a std::vector<std::array<std::array<double, 2>, 2>> and a std::vector<std::array<double, 4>> holding the same numbers are equal: "
+              << expect(isEqual(nestedBlocks, flatBlocks), false) << std::endl;
+    std::cout << "and if probing first, their difference statistics and their fingerprints all say the same: "
+              << expect(isEqualFastReject(nestedBlocks, flatBlocks), false) << ", " << expect(compareStats(nestedBlocks, flatBlocks).equal(), false) << " and "
+              << expect(mayBeEqual(makeFingerprint(nestedBlocks), makeFingerprint(flatBlocks)), false) << std::endl << std::endl;
+    std::cout << "if a std::vector<std::array<float, 1>> and a std::vector<float> with the same values are equal, either way around: "
+              << expect(isEqual(singletons, floatVector), false) << " and " << expect(isEqual(floatVector, singletons), false) << std::endl << std::endl;
+
+    std::vector<double> bigDoubleVector1(5000000, 64.36435);
+    std::vector<double> bigDoubleVector2(5000000, 64.36435);
+    std::vector<float>  bigFloatVector  (5000000, 64.36435f);
+
+    //Zero-copy tests, none of these comparisons should touch operator new at all, even through the recursive calls
+    std::size_t allocationsBefore = allocationCount;
+
+    bool zeroCopyEqual = isEqual(bigDoubleVector1, bigDoubleVector2)             &&
+                         isEqual(bigDoubleVector1, bigFloatVector, 1E-5)         &&
+                         isEqual(map1, map3)                                     &&
+                         isEqual(tupleTest3, tupleTest4)                         &&
+                         isEqual(pairTest4, pairTest5)                           &&
+                         isEqual(test1, test2)                                   &&
+                         isEqual(cArray1, arrayView);
+
+    std::size_t allocationsMade = allocationCount - allocationsBefore;
+
+    std::cout << "if 5M element vectors, maps, tuples, pairs, custom classes and views are all equal: "
+              << expect(zeroCopyEqual, true) << std::endl;
+    std::cout << "and if comparing them made zero allocations: "
+              << expect((allocationsMade == 0), true) << " (" << allocationsMade << " allocations)" << std::endl << std::endl;
+
+    //Compile-time tests, if any of these stop being constant expressions (or stop being true) this file stops compiling
+    constexpr std::array<int, 4>    constexprIntArray   = {1, 2, 3, 4};
+    constexpr std::array<double, 4> constexprDoubleArray = {1.000001, 2.0, 3.0, 4.0};
+
+    static_assert(isEqual(constexprIntArray, constexprDoubleArray),                      "std::arrays should fold at compile time");
+    static_assert(!isEqual(constexprIntArray, constexprDoubleArray, 0.0),                "and so should the tolerance");
+    static_assert(isEqual(std::make_tuple(1, 2.5f, 'c'), std::make_tuple(1, 2.5, 'c')),  "tuples should fold at compile time");
+    static_assert(isEqual(std::make_pair(36, 25.11), std::make_pair(36.0f, 25.11f)),     "pairs should fold at compile time");
+
+    std::cout << "if constexpr std::array<int, 4> and std::array<double, 4> are equal at compile time with a default tolerance: "
+              << std::bool_constant<isEqual(constexprIntArray, constexprDoubleArray)>::value << std::endl << std::endl;
+
+    std::vector<int>                          bigIntVector1(5000000, 36);
+    std::vector<int>                          bigIntVector2(5000000, 36);
+    std::vector<std::array<std::uint64_t, 8>> blockVector1(100000, {1, 2, 3, 4, 5, 6, 7, 8});
+    std::vector<std::array<std::uint64_t, 8>> blockVector2(100000, {1, 2, 3, 4, 5, 6, 7, 8});
+
+    //Bitwise tests, integers (and padding free aggregates of them) compared as raw bytes whenever the tolerance can't change the answer
+    std::cout << "if two 5M element std::vector<int>s are equal byte for byte: "
+              << expect(isEqual(bigIntVector1, bigIntVector2, 0.0), true) << std::endl << std::endl;
+    std::cout << "if two std::vector<std::array<std::uint64_t, 8>>s are equal byte for byte: "
+              << expect(isEqual(blockVector1, blockVector2), true) << std::endl << std::endl;
+
+    bigIntVector2[4999999]  = 37;
+    blockVector2[99999][7]  = 9;
+
+    std::cout << "if two 5M element std::vector<int>s that differ in the very last element are equal: "
+              << expect(isEqual(bigIntVector1, bigIntVector2, 0.0), false) << std::endl << std::endl;
+    std::cout << "but are with a tolerance of 1.5, which the bytes alone can't answer: "
+              << expect(isEqual(bigIntVector1, bigIntVector2, 1.5), true) << std::endl << std::endl;
+    std::cout << "if two std::vector<std::array<std::uint64_t, 8>>s that differ in the very last value are equal: "
+              << expect(isEqual(blockVector1, blockVector2), false) << std::endl << std::endl;
+
+    std::int64_t bigInt64 = (std::int64_t(1) << 60) + 1;
+
+    //Tolerance policy tests, each pair of types compared in the cheapest arithmetic that still gets it right
+    std::cout << "if 2^60 + 1 and 2^60 as std::int64_ts are equal with a tolerance of 0.5, which a trip through double would say they are: "
+              << expect(isEqual(bigInt64, bigInt64 - 1, 0.5), false) << std::endl << std::endl;
+    std::cout << "if 2^60 + 1 as a std::int64_t and 2^60 as a double are equal with a tolerance of 0.5: "
+              << expect(isEqual(bigInt64, static_cast<double>(bigInt64 - 1), 0.5), false) << std::endl << std::endl;
+    std::cout << "if 0.1 and 0.1 + 1E-13 are equal with a tolerance of 1E-12, which used to get rounded through float: "
+              << expect(isEqual(0.1, 0.1 + 1E-13, 1E-12), true) << std::endl << std::endl;
+    std::cout << "if 1E9 and 1E9 + 1 are equal with a RelativeTolerance(1E-8): "
+              << expect(isEqual(1E9, 1E9 + 1, RelativeTolerance(1E-8)), true) << std::endl << std::endl;
+    std::cout << "if 1.0f and the float right after it are equal with an UlpTolerance(1): "
+              << expect(isEqual(1.0f, std::nextafter(1.0f, 2.0f), UlpTolerance(1)), true) << std::endl << std::endl;
+    std::cout << "if 0.0 and 1E-13 are equal with an AbsRelTolerance(1E-12, 1E-9), where a relative one alone never could be: "
+              << expect(isEqual(0.0, 1E-13, AbsRelTolerance(1E-12, 1E-9)), true) << std::endl << std::endl;
+    std::cout << "if -1 and the largest std::uint64_t are equal with an ExactTolerance: "
+              << expect(isEqual(-1, std::numeric_limits<std::uint64_t>::max(), ExactTolerance()), false) << std::endl << std::endl;
+
+    //SIMD tests, every kernel the CPU supports has to agree with the scalar path on every single pair, including the nasty values
+    std::mt19937                          randomEngine(36);
+    std::uniform_real_distribution<float> valueDistribution(-100.0f, 100.0f);
+    std::uniform_int_distribution<int>    perturbationDistribution(0, 15);
+
+    const float nastyValues[] = { 0.0f, -0.0f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                                  std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::denorm_min(), 1E-5f, -1E-5f };
+
+    bool              simdMatchesScalar = true;
+    AbsoluteTolerance simdTolerance(1E-5);
+
+    for(std::size_t trial = 0; trial < 2000; ++trial){
+
+        std::size_t         length = trial % 150;
+        std::vector<float>  floats1(length);
+        std::vector<float>  floats2(length);
+        std::vector<double> doubles(length);
+
+        for(std::size_t index = 0; index < length; ++index){
+
+            floats1[index] = valueDistribution(randomEngine);
+            floats2[index] = floats1[index];
+            doubles[index] = floats1[index];
+
+            //Mostly equal runs, with the odd value nudged right around the tolerance or swapped for something nasty
+            switch(perturbationDistribution(randomEngine)){
+                case 0:  floats2[index] += 1E-5f; doubles[index] += 1E-5;       break;
+                case 1:  floats2[index] -= 2E-5f; doubles[index] -= 0.99999E-5; break;
+                case 2:  floats2[index] = doubles[index] = nastyValues[trial % 8]; break;
+                default: break;
+            }
+
+        }
+
+        for(isEqualDetail::SimdLevel simdLevel : { isEqualDetail::SimdLevel::SSE2, isEqualDetail::SimdLevel::AVX2, isEqualDetail::SimdLevel::AVX512 }){
+
+            if(simdLevel > isEqualDetail::detectSimdLevel()){
+
+                continue;
+
+            }
+
+            simdMatchesScalar &= isEqualDetail::compareContiguous(floats1.data(), floats2.data(), length, simdTolerance, simdLevel) ==
+                                 isEqualDetail::compareContiguousScalar(floats1.data(), floats2.data(), length, simdTolerance);
+            simdMatchesScalar &= isEqualDetail::compareContiguous(floats1.data(), doubles.data(), length, simdTolerance, simdLevel) ==
+                                 isEqualDetail::compareContiguousScalar(floats1.data(), doubles.data(), length, simdTolerance);
+            simdMatchesScalar &= isEqualDetail::compareContiguous(doubles.data(), floats2.data(), length, simdTolerance, simdLevel) ==
+                                 isEqualDetail::compareContiguousScalar(doubles.data(), floats2.data(), length, simdTolerance);
+            simdMatchesScalar &= isEqualDetail::compareContiguous(doubles.data(), doubles.data(), length, AbsoluteTolerance(0.0), simdLevel) ==
+                                 isEqualDetail::compareContiguousScalar(doubles.data(), doubles.data(), length, AbsoluteTolerance(0.0));
+
+        }
+
+    }
+
+    std::cout << "if every vectorized kernel this CPU supports agrees with the scalar path bit for bit: "
+              << expect(simdMatchesScalar, true) << std::endl << std::endl;
+
+    std::unordered_map<int, double> unorderedMap1;
+    std::unordered_map<int, float>  unorderedMap2(1024);
+    std::unordered_set<long>        unorderedSet1;
+    std::unordered_set<int>         unorderedSet2(1024);
+
+    //Fill them in opposite orders (and with different bucket counts) so they really do iterate differently
+    for(int key = 0; key < 1000; ++key){
+
+        unorderedMap1.emplace(key,        key * 1.5);
+        unorderedMap2.emplace(999 - key, (999 - key) * 1.5f);
+        unorderedSet1.insert(key);
+        unorderedSet2.insert(999 - key);
+
+    }
+
+    std::map<int, double, std::greater<int>> descendingMap(unorderedMap1.begin(), unorderedMap1.end());
+    std::set<int, std::greater<int>>         descendingSet1 = {1, 36, 25, 22};
+    std::set<int, std::greater<int>>         descendingSet2 = {22, 25, 36, 1};
+
+    //Unordered containers, compared by looking keys up instead of by position
+    std::cout << "if a std::unordered_map<int, double> and a std::unordered_map<int, float> filled in opposite orders are equal with a default tolerance: "
+              << expect(isEqual(unorderedMap1, unorderedMap2), true) << std::endl << std::endl;
+    std::cout << "if a std::unordered_map<int, double> and a std::map<int, double, std::greater<int>> with the same entries are equal: "
+              << expect(isEqual(unorderedMap1, descendingMap), true) << std::endl << std::endl;
+    std::cout << "if a std::unordered_set<long> and a std::unordered_set<int> filled in opposite orders are equal: "
+              << expect(isEqual(unorderedSet1, unorderedSet2), true) << std::endl << std::endl;
+    std::cout << "if two std::set<int, std::greater<int>>s with the same elements are equal: "
+              << expect(isEqual(descendingSet1, descendingSet2), true) << std::endl << std::endl;
+
+    unorderedMap2[500] = 0.0f;
+    unorderedSet2.erase(500);
+    unorderedSet2.insert(1000);
+
+    std::cout << "if a std::unordered_map<int, double> and a std::unordered_map<int, float> with one differing value are equal: "
+              << expect(isEqual(unorderedMap1, unorderedMap2), false) << std::endl << std::endl;
+    std::cout << "if a std::unordered_set<long> and a std::unordered_set<int> with one differing key are equal: "
+              << expect(isEqual(unorderedSet1, unorderedSet2), false) << std::endl << std::endl;
+
+    std::unordered_set<long long>   wideKeySet   = {(1LL << 32) + 1};
+    std::unordered_set<int>         narrowKeySet = {1};
+    std::unordered_map<double, int> doubleKeyMap = {{1.5, 7}};
+    std::unordered_map<int, int>    intKeyMap    = {{1, 7}};
+
+    //Keys that only find each other once they've been narrowed to the other side's key type (2^32 + 1 to an int is 1, so is 1.5) don't count
+    std::cout << "if a std::unordered_set<long long> {2^32 + 1} and a std::unordered_set<int> {1} are equal: "
+              << expect(isEqual(wideKeySet, narrowKeySet), false) << std::endl << std::endl;
+    std::cout << "if a std::unordered_map<double, int> {{1.5, 7}} and a std::unordered_map<int, int> {{1, 7}} are equal, either way around: "
+              << expect(isEqual(doubleKeyMap, intKeyMap), false) << " and " << expect(isEqual(intKeyMap, doubleKeyMap), false) << std::endl << std::endl;
+    std::cout << "if two std::map<double, int>s {{1 + 1E-12, 7}} and {{1, 7}} are equal, and as std::unordered_maps (keys are exact either way): "
+              << expect(isEqual(std::map<double, int>{{1.0 + 1E-12, 7}}, std::map<double, int>{{1.0, 7}}), false) << " and "
+              << expect(isEqual(std::unordered_map<double, int>{{1.0 + 1E-12, 7}}, std::unordered_map<double, int>{{1.0, 7}}), false) << std::endl << std::endl;
+
+    std::unordered_multiset<int>         unorderedMultiset1;
+    std::unordered_multiset<int>         unorderedMultiset2;
+    std::unordered_multimap<int, double> unorderedMultimap1;
+    std::unordered_multimap<int, float>  unorderedMultimap2;
+    std::multimap<int, double>           orderedMultimap;
+    std::string                          keyA = "a";
+    std::string                          keyB = "b";
+    std::unordered_map<std::string, int> stringKeyMap  = {{"a", 1}, {"b", 2}};
+    std::unordered_map<const char*, int> pointerKeyMap = {{keyA.c_str(), 1}, {keyB.c_str(), 2}};
+
+    //Every key 27 or 28 times over, each time with another value, and filled in opposite orders once more
+    for(int entry = 0; entry < 1000; ++entry){
+
+        unorderedMultiset1.insert(entry % 37);
+        unorderedMultiset2.insert((999 - entry) % 37);
+        unorderedMultimap1.emplace(entry % 37, entry * 0.5);
+        unorderedMultimap2.emplace((999 - entry) % 37, (999 - entry) * 0.5f);
+        orderedMultimap.emplace(entry % 37, entry * 0.5);
+
+    }
+
+    //Multisets and multimaps get every key's entries compared whatever order they're kept in, and a const char* key finds a std::string one
+    //(the pointers themselves are all a std::unordered_map<const char*, int> hashes, so it never gets looked up in)
+    std::cout << "if two std::unordered_multiset<int>s filled in opposite orders are equal: "
+              << expect(isEqual(unorderedMultiset1, unorderedMultiset2), true) << std::endl << std::endl;
+    std::cout << "if a std::unordered_multimap<int, double> and a std::unordered_multimap<int, float> filled in opposite orders are equal, and against a std::multimap: "
+              << expect(isEqual(unorderedMultimap1, unorderedMultimap2), true) << " and " << expect(isEqual(orderedMultimap, unorderedMultimap2), true) << std::endl << std::endl;
+    std::cout << "if a std::unordered_map<std::string, int> and a std::unordered_map<const char*, int> with the same entries are equal, either way around: "
+              << expect(isEqual(stringKeyMap, pointerKeyMap), true) << " and " << expect(isEqual(pointerKeyMap, stringKeyMap), true) << std::endl << std::endl;
+
+    unorderedMultiset2.erase(unorderedMultiset2.find(5));
+    unorderedMultiset2.insert(6);
+    unorderedMultimap2.find(3)->second += 1.0f;
+
+    std::cout << "if those std::unordered_multiset<int>s are equal with one 5 swapped for a 6, and those multimaps with one value under key 3 changed: "
+              << expect(isEqual(unorderedMultiset1, unorderedMultiset2), false) << " and " << expect(isEqual(unorderedMultimap1, unorderedMultimap2), false)
+              << std::endl << std::endl;
+
+    std::map<int, std::tuple<int, short, ImplictlyCompareMeCorrectly>> tupleMap1 = { {1, tupleTest3}, {36, tupleTest3} };
+    std::map<int, std::tuple<int, short, ImplictlyCompareMeCorrectly>> tupleMap2 = { {1, tupleTest3}, {36, tupleTest3} };
+
+    std::get<2>(tupleMap2[36]).dVector[2] = 4.0;
+
+    std::forward_list<double> forwardList = {1.2, 36.6, 25.11, 22.44};
+    std::istringstream        doubleStream("1.2 36.6 25.11 22.44");
+    std::istringstream        floatStream ("1.2 36.6 25.11 22.44");
+    std::istringstream        shortStream ("1.2 36.6 25.11");
+    std::istringstream        longStream  ("1.2 36.6 25.11 22.44 7");
+
+    int countUp1 = 0;
+    int countUp2 = 0;
+
+    auto countTo1000 = [&countUp1]() -> std::optional<int>    { return countUp1 < 1000 ? std::optional<int>(countUp1++) : std::nullopt; };
+    auto countTo999  = [&countUp2]() -> std::optional<double> { return countUp2 < 999  ? std::optional<double>(countUp2++) : std::nullopt; };
+
+    //Single pass tests, nothing here knows its length up front and nothing gets buffered
+    std::cout << "if a std::forward_list<double> and a std::vector<float> with equivalent initializer lists are equal with a default tolerance: "
+              << expect(isEqual(forwardList, floatVector), true) << std::endl << std::endl;
+    std::cout << "if a std::unordered_set<int> {1} and a std::forward_list<int> {1} are equal (a hashed container has no order to walk in lockstep): "
+              << expect(isEqual(narrowKeySet, std::forward_list<int>{1}), false) << std::endl << std::endl;
+    std::cout << "if two std::istream_iterator<double> and std::istream_iterator<float> streams with the same numbers are equal with a default tolerance: "
+              << expect(isEqualStream(std::istream_iterator<double>(doubleStream), std::istream_iterator<double>(),
+                                      std::istream_iterator<float>(floatStream),   std::istream_iterator<float>()), true) << std::endl << std::endl;
+    std::cout << "if two streams where one runs out an element early are equal: "
+              << expect(isEqualStream(std::istream_iterator<double>(shortStream), std::istream_iterator<double>(),
+                                      std::istream_iterator<double>(longStream),  std::istream_iterator<double>()), false) << std::endl << std::endl;
+    std::cout << "if generators counting to 1000 and to 999 are equal: "
+              << expect(isEqualGenerated(countTo1000, countTo999), false) << std::endl << std::endl;
+
+    MismatchReport firstMismatch;
+    MismatchReport allMismatches(10);
+
+    //Mismatch reports, which say exactly where two things stopped being equal
+    std::cout << "if two std::map<int, std::tuple<int, short, ImplictlyCompareMeCorrectly>>s that differ deep down are equal: "
+              << expect(isEqualWith(tupleMap1, tupleMap2, TOLERANCE, firstMismatch), false) << std::endl;
+    std::cout << "and where they differ: " << firstMismatch.toString() << std::endl;
+
+    std::cout << "if a std::vector<float> and a std::list<int> with similar initializer lists are equal with a default tolerance: "
+              << expect(isEqualWith(floatVector, intList, TOLERANCE, allMismatches), false) << std::endl;
+    std::cout << "and every place they differ:" << std::endl << allMismatches.toString() << std::endl;
+
+    //pmr tests, std::pmr containers are just the std ones with another allocator, and a report can keep everything it records in an arena
+    //that has nowhere else to go, so anything that slipped past it would throw instead of quietly hitting the global heap
+    alignas(std::max_align_t) std::byte arenaBuffer[32768];
+    std::pmr::monotonic_buffer_resource arena(arenaBuffer, sizeof(arenaBuffer), std::pmr::null_memory_resource());
+
+    std::pmr::map<int, double>           pmrMap(&arena);
+    std::pmr::unordered_map<int, double> pmrUnorderedMap(&arena);
+    std::pmr::vector<double>             pmrVector({1.0, 2.0, 3.0, 4.0}, &arena);
+    std::map<int, float>                 plainMap;
+    std::vector<double>                  plainVector = {1.0, 2.0, 3.5, 4.0};
+
+    for(int key = 0; key < 100; ++key){
+
+        pmrMap[key]          = key * 0.1;
+        pmrUnorderedMap[key] = key * 0.1;
+        plainMap[key]        = static_cast<float>(key * 0.1);
+
+    }
+
+    std::cout << "if a std::pmr::map<int, double> and a std::map<int, float> with the same entries are equal with a 1E-5 tolerance: "
+              << expect(isEqual(pmrMap, plainMap, 1E-5), true) << std::endl << std::endl;
+    std::cout << "if a std::pmr::unordered_map<int, double> and a std::map<int, float> with the same entries are equal with a 1E-5 tolerance: "
+              << expect(isEqual(pmrUnorderedMap, plainMap, 1E-5), true) << std::endl << std::endl;
+
+    MismatchReport arenaReport(1, &arena);
+    allocationsBefore = allocationCount;
+
+    bool arenaEqual = isEqualWith(pmrVector, plainVector, TOLERANCE, arenaReport);
+
+    allocationsMade = allocationCount - allocationsBefore;
+
+    std::cout << "if a std::pmr::vector<double> and a std::vector<double> differing in one element are equal: " << arenaEqual << std::endl;
+    std::cout << "and where they differ: " << arenaReport.toString();
+    std::cout << "and if the report kept all of that in the arena, with zero global allocations: "
+              << expect((allocationsMade == 0), true) << " (" << allocationsMade << " allocations)" << std::endl << std::endl;
+
+    ParallelOptions parallelOptions;
+    parallelOptions.threadCount     = 4;
+    parallelOptions.minimumElements = 0;
+    parallelOptions.chunkElements   = 4096;
+
+    std::map<int, std::vector<double>> vectorMap1;
+    std::map<int, std::vector<float>>  vectorMap2;
+
+    for(int key = 0; key < 10000; ++key){
+
+        vectorMap1[key] = {1.2, 36.6, 25.11, 22.44};
+        vectorMap2[key] = {1.2, 36.6, 25.11, 22.44};
+
+    }
+
+    //Parallel tests, forced onto 4 threads with small chunks even if this machine has fewer cores
+    std::cout << "if a 5M element std::vector<double> and std::vector<float> compared on 4 threads are equal: "
+              << expect(isEqualParallel(bigDoubleVector1, bigFloatVector, 1E-5, parallelOptions), true) << std::endl << std::endl;
+    std::cout << "if two std::map<int, std::vector<...>>s compared on 4 threads are equal: "
+              << expect(isEqualParallel(vectorMap1, vectorMap2, 1E-5, parallelOptions), true) << std::endl << std::endl;
+
+    std::vector<std::array<float, 3>>  bigPointCloud1(1000000, {1.2f, 36.6f, 25.11f});
+    std::vector<std::array<double, 3>> bigPointCloud2(1000000, {1.2, 36.6, 25.11});
+
+    bigPointCloud2.back()[2] = 25.12;
+
+    std::cout << "if two 1M point std::vector<std::array<...>, 3> point clouds that differ in the very last coordinate compared on 4 threads are equal: "
+              << expect(isEqualParallel(bigPointCloud1, bigPointCloud2, 1E-5, parallelOptions), false) << std::endl << std::endl;
+
+    ParallelOptions arenaParallelOptions = parallelOptions;
+    arenaParallelOptions.memoryResource  = &arena;
+
+    std::cout << "if the same two maps compared on 4 threads, with the chunk starts and worker ranges in the arena, are equal: "
+              << expect(isEqualParallel(vectorMap1, vectorMap2, 1E-5, arenaParallelOptions), true) << std::endl << std::endl;
+
+    bigDoubleVector2[4999999]  = 0.0;
+    vectorMap2[9999][3]        = 0.0f;
+
+    std::cout << "if two 5M element std::vector<double>s that differ in the very last element compared on 4 threads are equal: "
+              << expect(isEqualParallel(bigDoubleVector1, bigDoubleVector2, 1E-5, parallelOptions), false) << std::endl << std::endl;
+    std::cout << "if two std::map<int, std::vector<...>>s that differ in the very last value compared on 4 threads are equal: "
+              << expect(isEqualParallel(vectorMap1, vectorMap2, 1E-5, parallelOptions), false) << std::endl << std::endl;
+
+    //Fast reject tests, the same two pairs again, caught by the last block probe instead of a walk all the way to the end
+    std::cout << "if two 5M element std::vector<double>s that differ in the very last element are equal, probing before the full scan: "
+              << expect(isEqualFastReject(bigDoubleVector1, bigDoubleVector2), false) << std::endl << std::endl;
+    std::cout << "if two std::map<int, std::vector<...>>s that differ in the very last value are equal, probing before the full scan: "
+              << expect(isEqualFastReject(vectorMap1, vectorMap2), false) << std::endl << std::endl;
+    std::cout << "if a 5M element std::vector<double> and std::vector<float> are equal, probing before the full scan: "
+              << expect(isEqualFastReject(bigDoubleVector1, bigFloatVector), true) << std::endl << std::endl;
+
+    Fingerprinted<std::map<int, std::vector<double>>> fingerprintedMap(vectorMap1);
+    std::map<int, std::vector<float>>                  closeMap = vectorMap2;
+
+    closeMap[9999][3] = 22.44f;
+
+    Fingerprinted<std::vector<double>> growingVector(std::vector<double>{1.2, 36.6});
+
+    growingVector.append(25.11);
+    growingVector.append(22.44);
+
+    //Fingerprint tests, a cached digest throws out the clearly different candidates in O(1) and only the rest get the full comparison
+    std::cout << "if the fingerprint of a std::map<int, std::vector<double>> rules out the one that differs in the very last value: "
+              << expect(!mayBeEqual(fingerprintedMap.digest(), makeFingerprint(vectorMap2)), true) << std::endl << std::endl;
+    std::cout << "if a fingerprinted std::map<int, std::vector<double>> and a std::map<int, std::vector<float>> within tolerance are equal: "
+              << expect(isEqualFingerprinted(fingerprintedMap, closeMap), true) << std::endl << std::endl;
+    std::cout << "if a fingerprinted std::vector<double> built up to {1.2, 36.6, 25.11, 22.44} one append at a time and the same std::vector<float> are equal: "
+              << expect(isEqualFingerprinted(growingVector, floatVector), true) << std::endl << std::endl;
+    std::cout << "if that std::vector<double> and a std::list<int> with similar values are equal (rejected by the fingerprint alone): "
+              << expect(isEqualFingerprinted(growingVector, intList), false) << std::endl << std::endl;
+
+    Fingerprinted<std::vector<char>> fingerprintedChars(std::vector<char>{'a', 'b'});
+
+    //A std::vector<char> is a string against another string, but against a std::vector<int> it's the numbers it holds, and so is its fingerprint
+    std::cout << "if a fingerprinted std::vector<char> {'a', 'b'} and a std::vector<int> {97, 98} are equal, just like isEqual says: "
+              << expect(isEqualFingerprinted(fingerprintedChars, std::vector<int>{97, 98}), true) << std::endl << std::endl;
+    std::cout << "if that std::vector<char> and the std::string \"ab\" are equal, and \"ac\" is ruled out by the fingerprint alone: "
+              << expect(isEqualFingerprinted(fingerprintedChars, std::string("ab")), true) << " and " << expect(!mayBeEqual(fingerprintedChars.digest(), makeFingerprint(std::string("ac"))), true)
+              << std::endl << std::endl;
+
+    std::uniform_int_distribution<int> halfLengthDistribution(0, 4);
+    std::uniform_int_distribution<int> nudgeDistribution(0, 7);
+
+    std::size_t fingerprintedEqualPairs = 0;
+    std::size_t fingerprintRejections   = 0;
+
+    //Whatever isEqual calls equal, mayBeEqual must never rule out
+    auto checkFingerprints = [&](const auto& comparable1, const auto& comparable2){
+
+        auto checkOne = [&](const auto& tolerance){
+
+            if(isEqual(comparable1, comparable2, tolerance)){
+
+                ++fingerprintedEqualPairs;
+
+                if(!mayBeEqual(makeFingerprint(comparable1), makeFingerprint(comparable2), tolerance)){
+
+                    ++fingerprintRejections;
+
+                }
+
+            }
+
+        };
+
+        checkOne(AbsoluteTolerance(1E-5));
+        checkOne(RelativeTolerance(1E-6));
+        checkOne(AbsRelTolerance(1E-6, 1E-6));
+        checkOne(UlpTolerance(4));
+        checkOne(ExactTolerance());
+
+    };
+
+    for(std::size_t trial = 0; trial < 20000; ++trial){
+
+        std::size_t                                       length = 2 * static_cast<std::size_t>(halfLengthDistribution(randomEngine));
+        bool                                              whole  = trial % 2 == 0;
+        std::vector<double>                               doubles1(length);
+        std::vector<double>                               doubles2(length);
+        std::vector<float>                                floats1(length);
+        std::vector<float>                                floats2(length);
+        std::vector<std::int64_t>                         integers1(length);
+        std::vector<std::int64_t>                         integers2(length);
+        std::vector<std::array<double, 2>>                doublePairs1(length / 2);
+        std::vector<std::array<float, 2>>                 floatPairs2(length / 2);
+        std::vector<std::array<std::array<double, 1>, 2>> nestedPairs1(length / 2);
+        std::vector<std::array<double, 1>>                singletons1(length);
+
+        for(std::size_t index = 0; index < length; ++index){
+
+            doubles1[index] = whole ? std::round(valueDistribution(randomEngine)) : valueDistribution(randomEngine);
+            doubles2[index] = doubles1[index];
+
+            //Mostly equal, with the odd value nudged right around where one policy or another stops calling it equal
+            switch(nudgeDistribution(randomEngine)){
+                case 0:  doubles2[index] += 1E-5;                                 break;
+                case 1:  doubles2[index] *= 1 + 1E-6;                             break;
+                case 2:  doubles2[index]  = std::nextafter(doubles2[index], 1E3); break;
+                case 3:  doubles2[index] += 0.5;                                  break;
+                default: break;
+            }
+
+            floats1[index]   = static_cast<float>(doubles1[index]);
+            floats2[index]   = static_cast<float>(doubles2[index]);
+            integers1[index] = std::llround(doubles1[index]);
+            integers2[index] = std::llround(doubles2[index]);
+
+            doublePairs1[index / 2][index % 2]    = doubles1[index];
+            floatPairs2[index / 2][index % 2]     = floats2[index];
+            nestedPairs1[index / 2][index % 2][0] = doubles1[index];
+            singletons1[index][0]                 = doubles1[index];
+
+        }
+
+        checkFingerprints(doubles1,     doubles2);
+        checkFingerprints(doubles1,     floats2);
+        checkFingerprints(floats1,      doubles2);
+        checkFingerprints(floats1,      floats2);
+        checkFingerprints(doubles1,     integers2);
+        checkFingerprints(integers1,    doubles2);
+        checkFingerprints(integers1,    integers2);
+        checkFingerprints(floats1,      integers2);
+        checkFingerprints(doublePairs1, floatPairs2);
+        checkFingerprints(nestedPairs1, floatPairs2);
+        checkFingerprints(singletons1,  floats2);
+        checkFingerprints(floats2,      singletons1);
+
+    }
+
+    //Fingerprint agreement, random pairs of mixed element types and shapes against every policy, never rejected when isEqual calls them equal
+    std::cout << "how many of the random pairs isEqual called equal, under every policy, their fingerprints ruled out: "
+              << expect(fingerprintRejections, 0) << " of " << fingerprintedEqualPairs << std::endl << std::endl;
+
+    std::vector<double>             batchReference(10000);
+    std::vector<std::vector<float>> batchCandidates;
+
+    for(std::size_t index = 0; index < batchReference.size(); ++index){
+
+        batchReference[index] = static_cast<double>(index) * 0.25;
+
+    }
+
+    batchCandidates.assign(200, std::vector<float>(batchReference.begin(), batchReference.end()));
+    batchCandidates[17][9999] += 1.0f;
+    batchCandidates[150].pop_back();
+
+    BatchResult batchResult = isEqualBatch(batchReference, batchCandidates, 1E-5, parallelOptions);
+
+    std::vector<std::vector<double>> pairs1 = {doubleVector, doubleVector, {1.0, 2.0}};
+    std::list<std::list<int>>        pairs2 = {{1, 37, 25, 22}, {3, 36, 25, 22}, {1, 2}};
+
+    //Batch tests, one reference against many candidates (and many independent pairs) with one bit per answer
+    std::cout << "how many of 200 std::vector<float> candidates, one off in its last element and one an element short, equal a std::vector<double> reference: "
+              << expect(batchResult.equalCount(), 198) << " (candidate 17: " << expect(batchResult[17], false) << ", candidate 150: " << expect(batchResult[150], false) << ")" << std::endl << std::endl;
+    std::cout << "which of three std::vector<double> and std::list<int> pairs are equal with a tolerance of 1: "
+              << expect(isEqualBatchPairs(pairs1, pairs2, 1.0).word(0), 0b101) << " (as bits, the second pair is the one 1.8 away from 3)" << std::endl << std::endl;
+
+    std::vector<double> driftedVector = {1.2, 36.6000001, std::nan(""), 22.44, -std::numeric_limits<double>::infinity()};
+    std::vector<float>  driftVector   = {1.2f, 36.6f, 25.11f, 22.44f, 3.0f};
+
+    DifferenceStats listStats  = compareStats(floatVector, intList);
+    DifferenceStats driftStats = compareStats(driftedVector, driftVector);
+    DifferenceStats bigStats   = compareStats(bigDoubleVector1, bigDoubleVector2);
+    DifferenceStats mapStats   = compareStats(vectorMap1, vectorMap2);
+
+    //Difference statistics, how far apart two things are instead of just whether they are, all in one pass
+    std::cout << "how far apart a std::vector<float> and a std::list<int> with similar initializer lists are: "
+              << listStats.toString() << std::endl << std::endl;
+    std::cout << "how far apart a std::vector<double> with a NaN and an infinity and a std::vector<float> are: "
+              << driftStats.toString() << std::endl << std::endl;
+    std::cout << "how far apart two 5M element std::vector<double>s that differ in the very last element are: "
+              << bigStats.toString() << std::endl << std::endl;
+    std::cout << "how far apart two std::map<int, std::vector<...>>s that differ in the very last value are: "
+              << mapStats.toString() << std::endl << std::endl;
+
+    expect(listStats.overToleranceCount,  4);
+    expect(driftStats.overToleranceCount, 2);
+    expect(driftStats.overToleranceIndex, 2);
+    expect(driftStats.nanCount,           1);
+    expect(driftStats.infCount,           1);
+    expect(bigStats.overToleranceIndex,   4999999);
+    expect(mapStats.overToleranceIndex,   39999);
+
+    ComparisonInstrumentation instrumentation;
+
+    isEqualInstrumented(vectorMap1, vectorMap2, instrumentation);
+    isEqualInstrumented(floatVector, doubleVector, instrumentation);
+    isEqualInstrumented(bigDoubleVector1, bigDoubleVector2, instrumentation);
+    isEqualInstrumented(floatVector, intList, instrumentation);
+    isEqualInstrumented(floatVector, 2.9, instrumentation);
+
+    InstrumentationSnapshot counted = instrumentation.snapshot();
+
+    //Instrumentation, which branches the comparisons above went down and how long they took, counted per thread and added up on demand
+    std::cout << "how many of five instrumented comparisons stopped early, and how many fell into the always false incompatible type fallback: "
+              << expect(counted.earlyExits, 4) << " and " << expect(counted.branch(ComparisonBranch::Incompatible), 1) << std::endl << std::endl;
+    std::cout << "how many elements those five comparisons handed to a scan: "
+              << expect(counted.elements, 5050005) << std::endl << std::endl;
+    std::cout << "all of it as JSON: "
+              << counted.toJson() << std::endl << std::endl;
+
+    std::vector<Float16>     halfVector     = {Float16(1.2f), Float16(36.6f), Float16(25.11f), Float16(22.44f)};
+    std::vector<BFloat16>    bfloat16Vector = {BFloat16(1.2f), BFloat16(36.6f), BFloat16(25.11f), BFloat16(22.44f)};
+    std::vector<std::int8_t> quantizedBytes = {12, -7, 100, 0};
+    std::vector<float>       dequantizedVector = {1.2f, -0.7f, 10.0f, 0.0f};
+    std::vector<Float16>     bigHalfVector(bigDoubleVector1.size());
+    std::vector<Float16>     bigHalfVector2;
+
+    for(std::size_t index = 0; index < bigHalfVector.size(); ++index){
+
+        bigHalfVector[index] = Float16(static_cast<float>(bigDoubleVector2[index]));
+
+    }
+
+    bigHalfVector2        = bigHalfVector;
+    bigHalfVector2.back() = Float16(1000.0f);
+
+    QuantizedView<std::int8_t> quantizedView(quantizedBytes.data(), quantizedBytes.size(), 0.1f);
+    MismatchReport             halfReport;
+
+    bool halfEqual = isEqualWith(halfVector, floatVector, AbsoluteTolerance(1E-2), halfReport);
+
+    //Reduced precision tests, halves and bfloat16s only hold about 3 and 2 significant digits, quantized values are integers times a scale
+    std::cout << "if a std::vector<Float16> and a std::vector<float> with the same initializer list are equal with a 1E-2 tolerance: "
+              << expect(halfEqual, true) << std::endl << std::endl;
+    std::cout << "if they're equal with the default tolerance (they aren't, 1.2 is 1.2001953125 as a half): "
+              << expect(isEqualWith(halfVector, floatVector, AbsoluteTolerance(TOLERANCE), halfReport), false) << std::endl;
+    std::cout << "and where they differ: " << halfReport.toString() << std::endl;
+    std::cout << "if a std::vector<BFloat16> and a std::vector<double> with the same initializer list are equal with a 0.2 tolerance: "
+              << expect(isEqual(bfloat16Vector, doubleVector, 0.2), true) << std::endl << std::endl;
+    std::cout << "if int8 values {12, -7, 100, 0} with a scale of 0.1 and a std::vector<float> {1.2, -0.7, 10, 0} are equal: "
+              << expect(isEqual(quantizedView, dequantizedVector), true) << std::endl << std::endl;
+    std::cout << "if a 5M element std::vector<Float16> and the same std::vector<double> it was rounded from are equal with a tolerance of 1: "
+              << expect(isEqual(bigHalfVector, bigDoubleVector2, 1.0), true) << std::endl << std::endl;
+    std::cout << "if two 5M element std::vector<Float16>s that differ in the very last element compared on 4 threads are equal: "
+              << expect(isEqualParallel(bigHalfVector, bigHalfVector2, 1E-5, parallelOptions), false) << std::endl << std::endl;
+
+    #if __has_include(<sys/mman.h>)
+
+    std::string floatPath        = (std::filesystem::temp_directory_path() / "isEqualDemo.f32").string();
+    std::string doublePath       = (std::filesystem::temp_directory_path() / "isEqualDemo.f64").string();
+    std::string floatHeaderPath  = (std::filesystem::temp_directory_path() / "isEqualDemoHeader.f32").string();
+    std::string doubleHeaderPath = (std::filesystem::temp_directory_path() / "isEqualDemoHeader.f64").string();
+    std::string shortPath        = (std::filesystem::temp_directory_path() / "isEqualDemoShort.f64").string();
+    std::string emptyPath        = (std::filesystem::temp_directory_path() / "isEqualDemoEmpty.f64").string();
+
+    std::vector<float>  fileFloats(10000);
+    std::vector<double> fileDoubles(10000);
+
+    for(std::size_t index = 0; index < fileFloats.size(); ++index){
+
+        fileFloats[index]  = static_cast<float>(index) * 0.25f;
+        fileDoubles[index] = fileFloats[index];
+
+    }
+
+    std::vector<double> fileDoublesOneOff = fileDoubles;
+    std::vector<double> fileDoublesShort(fileDoubles.begin(), fileDoubles.begin() + 6000);
+
+    fileDoublesOneOff[9000] += 1.0;
+
+    writeElementFile(floatPath,        0, fileFloats);
+    writeElementFile(doublePath,       0, fileDoubles);
+    writeElementFile(floatHeaderPath,  3, fileFloats);
+    writeElementFile(doubleHeaderPath, 5, fileDoublesOneOff);
+    writeElementFile(shortPath,        0, fileDoublesShort);
+    writeElementFile(emptyPath,        0, std::vector<double>());
+
+    //1024 floats a window, so every comparison below crosses a few of them (and the headers push both files off alignment, into the staging blocks)
+    FileCompareOptions smallWindows;
+    smallWindows.windowBytes = 4096;
+
+    FileCompareOptions headerOptions = smallWindows;
+    headerOptions.offset1 = 3;
+    headerOptions.offset2 = 5;
+
+    FileCompareOptions countOptions = smallWindows;
+    countOptions.maxElements = 6000;
+
+    FileCompareOptions pastEndOptions;
+    pastEndOptions.offset1 = 8;
+
+    FileCompareOptions noWindowOptions;
+    noWindowOptions.windowBytes = 0;
+
+    FileCompareResult alignedResult  = isEqualFiles<float, double>(floatPath, doublePath, AbsoluteTolerance(TOLERANCE), smallWindows);
+    FileCompareResult headerResult   = isEqualFiles<float, double>(floatHeaderPath, doubleHeaderPath, AbsoluteTolerance(TOLERANCE), headerOptions);
+    FileCompareResult shortResult    = isEqualFiles<float, double>(floatPath, shortPath, AbsoluteTolerance(TOLERANCE), smallWindows);
+    FileCompareResult countResult    = isEqualFiles<float, double>(floatPath, shortPath, AbsoluteTolerance(TOLERANCE), countOptions);
+    FileCompareResult emptyResult    = isEqualFiles<double, double>(emptyPath, emptyPath);
+    FileCompareResult pastEndResult  = isEqualFiles<double, double>(emptyPath, emptyPath, AbsoluteTolerance(TOLERANCE), pastEndOptions);
+    FileCompareResult noWindowResult = isEqualFiles<float, double>(floatPath, doublePath, AbsoluteTolerance(TOLERANCE), noWindowOptions);
+
+    for(const std::string& path : {floatPath, doublePath, floatHeaderPath, doubleHeaderPath, shortPath, emptyPath}){
+
+        std::remove(path.c_str());
+
+    }
+
+    //File tests, binary dumps written to the temp directory and compared straight out of the page cache a window at a time
+    std::cout << "if a float file and a double file holding the same 10000 values are equal: "
+              << expect(alignedResult.equal, true) << " (" << expect(alignedResult.elementsCompared, 10000) << " elements compared)" << std::endl << std::endl;
+    std::cout << "if the same two behind 3 and 5 byte headers, with element 9000 one off in the second, are equal: "
+              << expect(headerResult.equal, false) << std::endl;
+    std::cout << "and if that's reported as element 9000, at byte 3 + 9000 * 4 of the first file and byte 5 + 9000 * 8 of the second: "
+              << expect((headerResult.hasMismatch && headerResult.mismatchIndex == 9000 && headerResult.mismatchOffset1 == 36003 && headerResult.mismatchOffset2 == 72005), true)
+              << " (" << headerResult.value1 << " vs " << headerResult.value2 << ")" << std::endl << std::endl;
+    std::cout << "if that float file and a double file with only its first 6000 values are equal, and if their first 6000 elements are: "
+              << expect(shortResult.equal, false) << " (" << expect(shortResult.elementCount1, 10000) << " vs " << expect(shortResult.elementCount2, 6000) << " elements) and "
+              << expect(countResult.equal, true) << " (" << expect(countResult.elementsCompared, 6000) << " elements compared)" << std::endl << std::endl;
+    std::cout << "if two empty files are equal: "
+              << expect(emptyResult.equal, true) << std::endl << std::endl;
+    std::cout << "if comparing them 8 bytes in fails, and so does a window of 0 bytes: "
+              << expect(!pastEndResult.error.empty(), true) << " and " << expect(!noWindowResult.error.empty(), true) << std::endl;
+    std::cout << "and what they say: "
+              << pastEndResult.error << " and " << noWindowResult.error << std::endl << std::endl;
+
+    #endif
+
+    //If you want to play with the pointers, go ahead, uncomment this block
+
+    /*
+     *  int* intPtr      = new int(5);
+     *  int* otherIntPtr = intPtr;
+     *  isEqual(intPtr, otherIntPtr);  //will be true
+     *  isEqual(nullptr, otherIntPtr); //will be false
+     *  isEqual(nullptr, nullptr);
+     *
+     *  int* ourNullptr      = nullptr;
+     *  int* ourOtherNullptr = nullptr;
+     *  isEqual(ourNullptr, ourOtherNullptr); //Luckily returns true
+     *
+     *  int* ourUninitializedPtr;
+     *  int* ourOtherUninitializedPtr;
+     *  isEqual(ourUninitializedPtr, ourOtherUninitializedPtr); //This one depends on if your system nulls out memory for you, so it's undefined behavior
+     */
+
+    if(failedChecks){
+
+        std::cout << failedChecks << " of the results above weren't what they should have been" << std::endl;
+
+        return 1;
+
+    }
+
+    return 0;
+
+}